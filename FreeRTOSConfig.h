@@ -123,6 +123,7 @@
 #define INCLUDE_vTaskSuspend		0
 #define INCLUDE_vTaskDelayUntil		0
 #define INCLUDE_vTaskDelay		1
+#define INCLUDE_xTaskGetCurrentTaskHandle	1
 
 /* This is the raw value as per the Cortex-M3 NVIC.  Values can be 255
    (lowest) to 0 (1?) (highest). */
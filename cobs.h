@@ -0,0 +1,67 @@
+#ifndef __COBS_H__
+#define __COBS_H__
+
+#include <stdint.h>
+
+// Consistent Overhead Byte Stuffing: the encoded data contains no zero bytes, thus a zero can delimit the frames
+// on a byte stream which carries NMEA text as well. The overhead is one byte for up to 254 bytes of data.
+// The frames go out as 0x00 <COBS(record+CRC)> 0x00: a reader which is in the middle of text starts a frame
+// at the first zero and goes back to text after the second one.
+
+inline uint16_t CRC16_CCITT(uint16_t Check, uint8_t Byte)             // CRC-16/CCITT, polynomial 0x1021, byte by byte
+{ Check  = (uint8_t)(Check >> 8) | (Check << 8);
+  Check ^= Byte;
+  Check ^= (uint8_t)(Check & 0xff) >> 4;
+  Check ^= (Check << 8) << 4;
+  Check ^= ((Check & 0xff) << 4) << 1;
+  return Check; }
+
+inline uint16_t CRC16_CCITT(const uint8_t *Data, uint8_t Len, uint16_t Check=0xFFFF)
+{ for(uint8_t Idx=0; Idx<Len; Idx++) Check=CRC16_CCITT(Check, Data[Idx]);
+  return Check; }
+
+inline uint8_t COBS_Encode(uint8_t *Out, const uint8_t *Inp, uint8_t Len) // returns the encoded length: Len+1, max. Len=254
+{ uint8_t CodeIdx=0; uint8_t Code=1; uint8_t OutLen=1;
+  for(uint8_t Idx=0; Idx<Len; Idx++)
+  { uint8_t Byte=Inp[Idx];
+    if(Byte) { Out[OutLen++]=Byte; Code++; }
+        else { Out[CodeIdx]=Code; CodeIdx=OutLen++; Code=1; }         // a zero: close the block, its code points to the next zero
+  }
+  Out[CodeIdx]=Code;
+  return OutLen; }
+
+inline int COBS_Decode(uint8_t *Out, const uint8_t *Inp, uint8_t Len)   // returns the decoded length or -1 for a corrupt frame
+{ uint8_t OutLen=0; uint8_t Idx=0;
+  while(Idx<Len)
+  { uint8_t Code=Inp[Idx++];
+    if(Code==0) return -1;                                             // zeros can not be inside the frame
+    if(Idx+Code-1>Len) return -1;                                      // block past the frame end
+    for(uint8_t Byte=1; Byte<Code; Byte++)
+    { uint8_t Data=Inp[Idx++]; if(Data==0) return -1;
+      Out[OutLen++]=Data; }
+    if(Idx<Len) Out[OutLen++]=0; }                                     // every block but the last one ends with a zero (Len<=255)
+  return OutLen; }
+
+class COBS_RxFrame                   // splits a byte stream into text and the zero-delimited frames
+{ public:
+   static const uint8_t MaxLen=64;    // longest frame accepted
+   uint8_t Data[MaxLen];              // the COBS encoded frame
+   uint8_t Len;
+   bool    inFrame;                   // between the zero delimiters
+
+  public:
+   void Clear(void) { Len=0; inFrame=0; }
+
+   int ProcessByte(uint8_t Byte)      // returns: 0 = byte taken into the frame, 1 = text byte, 2 = frame complete in Data[Len]
+   { if(!inFrame)
+     { if(Byte) return 1;
+       inFrame=1; Len=0; return 0; }
+     if(Byte==0)
+     { if(Len==0) return 0;           // two zeros: the end of the previous frame was missed, this is the start
+       inFrame=0; return 2; }
+     if(Len<MaxLen) Data[Len++]=Byte;
+               else inFrame=0;        // too long: not a frame, drop it
+     return 0; }
+} ;
+
+#endif // __COBS_H__
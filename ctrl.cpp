@@ -213,6 +213,13 @@ void Log_Write(char Byte)                                         // write a byt
 { if(Log_FIFO.Write(Byte)>0) return;                              // if byte written into FIFO return
   while(Log_FIFO.Write(Byte)<=0) vTaskDelay(1); }                 // wait while the FIFO is full - we have to use vTaskDelay not TaskYIELD
 
+void Log_WriteBlock(const char *Data, uint8_t Len)               // write a block into the log file buffer: one FIFO commit per block
+{ for( ; ; )
+  { uint8_t Done=Log_FIFO.Write(Data, Len);
+    Data+=Done; Len-=Done; if(Len==0) break;
+    vTaskDelay(1); }                                              // wait while the FIFO is full
+}
+
 int Log_Free(void) { return Log_FIFO.Free(); }                    // how much space left in the buffer
                                                                   // TaskYIELD would not give time to lower priority task like log-writer
 static void Log_Open(void)
@@ -4,6 +4,7 @@
 #ifdef WITH_SDLOG
 extern SemaphoreHandle_t Log_Mutex;
 void Log_Write(char Byte);
+void Log_WriteBlock(const char *Data, uint8_t Len);
 int Log_Free(void);
 #endif
 
@@ -78,11 +78,14 @@ template <class Type, const size_t Size=8> // size must be (!) a power of 2 like
    bool isEmpty(void) const              // is the FIFO all empty ?
    { return ReadPtr==WritePtr; }
 
-   size_t Write(const Type *Data, size_t Len) // write a block of elements into the FIFO (could possibly be smarter than colling single Write many times)
-   { size_t Idx;
-     for(Idx=0; Idx<Len; Idx++)
-     { if(Write(Data[Idx])==0) break; }
-     return Idx; }
+   size_t Write(const Type *Block, size_t Len) // write a block of elements into the FIFO: as many as there is space for, the write pointer moves once
+   { size_t Space=Free(); if(Len>Space) Len=Space;
+     size_t Ptr=WritePtr;
+     size_t Tail=Size-Ptr; if(Tail>Len) Tail=Len;                     // up to the end of the buffer
+     for(size_t Idx=0; Idx<Tail; Idx++) Data[Ptr+Idx]=Block[Idx];
+     for(size_t Idx=Tail; Idx<Len; Idx++) Data[Idx-Tail]=Block[Idx]; // the rest wraps to the start
+     WritePtr=(Ptr+Len)&PtrMask;
+     return Len; }
 
 /*
    Type Read(void)
@@ -4,6 +4,56 @@
 
 char HexDigit(uint8_t Val) { return Val+(Val<10?'0':'A'-10); }
 
+// ------------------------------------------------------------------------------------------
+// Decimal numbers two digits at a time: a division by the constant 100, which the compiler turns into a multiply
+// by the reciprocal (UMULL on the Cortex-M3), and a table of the 100 digit pairs. The former loops divided by
+// a variable base (UDIV) for every one of the 10 positions.
+
+static const char DecPairs[201] = "00010203040506070809101112131415161718192021222324252627282930313233343536373839404142434445464748495051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+static const uint32_t Pow10[10] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 } ;
+
+static void Format_Pair(char *Out, uint32_t Value) { Out[0]=DecPairs[2*Value]; Out[1]=DecPairs[2*Value+1]; } // Value=0..99
+
+static uint8_t DecDigits(uint32_t Value)                         // number of decimal digits: 0 for zero
+{ if(Value==0) return 0;
+  uint8_t Digits=((32-__builtin_clz(Value))*1233)>>12;           // log10 by log2: exact or one below
+  return Digits+(Value>=Pow10[Digits]); }
+
+static uint8_t DecDigits(uint64_t Value)
+{ if((Value>>32)==0) return DecDigits((uint32_t)Value);
+  uint8_t Digits=10; uint64_t Base=10000000000ULL;
+  for( ; Digits<20 && Value>=Base; Digits++) Base*=10;
+  return Digits; }
+
+static uint32_t Format_Digits(char *End, uint32_t Value, uint8_t Digits) // Digits digits which end before End, returns what is left of Value
+{ for( ; Digits>=2; Digits-=2)
+  { uint32_t Div=Value/100; End-=2; Format_Pair(End, Value-100*Div); Value=Div; }
+  if(Digits) { uint32_t Div=Value/10; *(--End)='0'+(Value-10*Div); Value=Div; }
+  return Value; }
+
+static uint64_t Format_Digits(char *End, uint64_t Value, uint8_t Digits) // 64-bit divisions only while the value does not fit 32 bits
+{ for( ; Digits && (Value>>32); Digits--)
+  { uint64_t Div=Value/10; *(--End)='0'+(Value-10*Div); Value=Div; }
+  if(Digits==0) return Value;
+  return Format_Digits(End, (uint32_t)Value, Digits); }
+
+// same output as the per-digit loops over Positions: at least MinDigits digits, DecPoint digits after the dot,
+// the positions before the dot only when not zero or below MinDigits, the dot only when it falls between the positions
+template <class Type>
+ static uint8_t Format_Dec(char *Out, Type Value, uint8_t MinDigits, uint8_t DecPoint, uint8_t Positions)
+{ uint8_t Len=DecDigits(Value);
+  if(DecPoint>Positions) { Len=Positions; DecPoint=0; }
+  if(MinDigits>Positions) MinDigits=Positions;
+  if(Len<MinDigits) Len=MinDigits;
+  if(Len<DecPoint) Len=DecPoint;
+  char *End=Out+Len;
+  if(DecPoint)
+  { End++; Value=Format_Digits(End, Value, DecPoint);
+    End-=DecPoint; *(--End)='.'; }
+  Format_Digits(End, Value, Len-DecPoint);
+  return Len+(DecPoint>0); }
+
 // ------------------------------------------------------------------------------------------
 
 void Format_Bytes( void (*Output)(char), const uint8_t *Bytes, uint8_t Len)
@@ -12,13 +62,7 @@ void Format_Bytes( void (*Output)(char), const uint8_t *Bytes, uint8_t Len)
 }
 
 void Format_String( void (*Output)(char), const char *String)
-{ for( ; ; )
-  { uint8_t ch = (*String++); if(ch==0) break;
-#ifdef WITH_AUTOCR
-    if(ch=='\n') (*Output)('\r');
-#endif
-    (*Output)(ch); }
-}
+{ Format_FuncSink Out(Output); Format_String(Out, String); }
 
 uint8_t Format_String(char *Out, const char *String)
 { uint8_t OutLen=0;
@@ -32,17 +76,7 @@ uint8_t Format_String(char *Out, const char *String)
   return OutLen; }
 
 void Format_String( void (*Output)(char), const char *String, uint8_t MinLen, uint8_t MaxLen)
-{ if(MaxLen<MinLen) MaxLen=MinLen;
-  uint8_t Idx;
-  for(Idx=0; Idx<MaxLen; Idx++)
-  { char ch = String[Idx]; if(ch==0) break;
-#ifdef WITH_AUTOCR
-    if(ch=='\n') (*Output)('\r');
-#endif
-    (*Output)(ch); }
-  for(    ; Idx<MinLen; Idx++)
-    (*Output)(' ');
-}
+{ Format_FuncSink Out(Output); Format_String(Out, String, MinLen, MaxLen); }
 
 uint8_t Format_String(char *Out, const char *String, uint8_t MinLen, uint8_t MaxLen)
 { if(MaxLen<MinLen) MaxLen=MinLen;
@@ -60,96 +94,52 @@ uint8_t Format_String(char *Out, const char *String, uint8_t MinLen, uint8_t Max
   return OutLen; }
 
 void Format_Hex( void (*Output)(char), uint8_t Byte )
-{ (*Output)(HexDigit(Byte>>4)); (*Output)(HexDigit(Byte&0x0F)); }
+{ Format_FuncSink Out(Output); Format_Hex(Out, Byte); }
 
 void Format_Hex( void (*Output)(char), uint16_t Word )
-{ Format_Hex(Output, (uint8_t)(Word>>8)); Format_Hex(Output, (uint8_t)Word); }
+{ Format_FuncSink Out(Output); Format_Hex(Out, Word); }
 
 void Format_Hex( void (*Output)(char), uint32_t Word )
-{ Format_Hex(Output, (uint8_t)(Word>>24)); Format_Hex(Output, (uint8_t)(Word>>16));
-  Format_Hex(Output, (uint8_t)(Word>>8));  Format_Hex(Output, (uint8_t)Word); }
+{ Format_FuncSink Out(Output); Format_Hex(Out, Word); }
 
 uint8_t Format_HHMMSS(char *Out, uint32_t Time)
 { uint32_t DayTime=Time%86400;
   uint32_t Hour=DayTime/3600; DayTime-=Hour*3600;
   uint32_t Min=DayTime/60; DayTime-=Min*60;
   uint32_t Sec=DayTime;
-  uint32_t HHMMSS = 10000*Hour + 100*Min + Sec;
-  return Format_UnsDec(Out, HHMMSS, 6); }
+  Format_Pair(Out, Hour); Format_Pair(Out+2, Min); Format_Pair(Out+4, Sec);
+  return 6; }
+
+// the per-character callback API: thin adapters over the sink templates of format.h
 
 void Format_UnsDec( void (*Output)(char), uint16_t Value, uint8_t MinDigits, uint8_t DecPoint)
-{ uint16_t Base; uint8_t Pos;
-  for( Pos=5, Base=10000; Base; Base/=10, Pos--)
-  { uint8_t Dig;
-    if(Value>=Base)
-    { Dig=Value/Base; Value-=Dig*Base; }
-    else
-    { Dig=0; }
-    if(Pos==DecPoint) (*Output)('.');
-    if( (Pos<=MinDigits) || (Dig>0) || (Pos<=DecPoint) )
-    { (*Output)('0'+Dig); MinDigits=Pos; }
-  }
-}
+{ Format_FuncSink Out(Output); Format_UnsDec(Out, Value, MinDigits, DecPoint); }
 
 void Format_SignDec( void (*Output)(char), int16_t Value, uint8_t MinDigits, uint8_t DecPoint)
-{ if(Value<0) { (*Output)('-'); Value=(-Value); }
-         else { (*Output)('+'); }
-  Format_UnsDec(Output, (uint16_t)Value, MinDigits, DecPoint); }
+{ Format_FuncSink Out(Output); Format_SignDec(Out, Value, MinDigits, DecPoint); }
 
 void Format_UnsDec( void (*Output)(char), uint32_t Value, uint8_t MinDigits, uint8_t DecPoint)
-{ uint32_t Base; uint8_t Pos;
-  for( Pos=10, Base=1000000000; Base; Base/=10, Pos--)
-  { uint8_t Dig;
-    if(Value>=Base)
-    { Dig=Value/Base; Value-=Dig*Base; }
-    else
-    { Dig=0; }
-    if(Pos==DecPoint) (*Output)('.');
-    if( (Pos<=MinDigits) || (Dig>0) || (Pos<=DecPoint) )
-    { (*Output)('0'+Dig); MinDigits=Pos; }
-  }
-}
+{ Format_FuncSink Out(Output); Format_UnsDec(Out, Value, MinDigits, DecPoint); }
 
 void Format_SignDec( void (*Output)(char), int32_t Value, uint8_t MinDigits, uint8_t DecPoint)
-{ if(Value<0) { (*Output)('-'); Value=(-Value); }
-         else { (*Output)('+'); }
-  Format_UnsDec(Output, (uint32_t)Value, MinDigits, DecPoint); }
+{ Format_FuncSink Out(Output); Format_SignDec(Out, Value, MinDigits, DecPoint); }
 
 void Format_UnsDec( void (*Output)(char), uint64_t Value, uint8_t MinDigits, uint8_t DecPoint)
-{ uint64_t Base; uint8_t Pos;
-  for( Pos=20, Base=10000000000000000000; Base; Base/=10, Pos--)
-  { uint8_t Dig;
-    if(Value>=Base)
-    { Dig=Value/Base; Value-=Dig*Base; }
-    else
-    { Dig=0; }
-    if(Pos==DecPoint) (*Output)('.');
-    if( (Pos<=MinDigits) || (Dig>0) || (Pos<=DecPoint) )
-    { (*Output)('0'+Dig); MinDigits=Pos; }
-  }
-}
+{ Format_FuncSink Out(Output); Format_UnsDec(Out, Value, MinDigits, DecPoint); }
 
 void Format_SignDec( void (*Output)(char), int64_t Value, uint8_t MinDigits, uint8_t DecPoint)
-{ if(Value<0) { (*Output)('-'); Value=(-Value); }
-         else { (*Output)('+'); }
-  Format_UnsDec(Output, (uint32_t)Value, MinDigits, DecPoint); }
+{ Format_FuncSink Out(Output); Format_SignDec(Out, Value, MinDigits, DecPoint); }
 
 // ------------------------------------------------------------------------------------------
 
+uint8_t Format_DecPos(char *Out, uint32_t Value, uint8_t MinDigits, uint8_t DecPoint, uint8_t Positions)
+{ return Format_Dec(Out, Value, MinDigits, DecPoint, Positions); }
+
+uint8_t Format_DecPos(char *Out, uint64_t Value, uint8_t MinDigits, uint8_t DecPoint, uint8_t Positions)
+{ return Format_Dec(Out, Value, MinDigits, DecPoint, Positions); }
+
 uint8_t Format_UnsDec(char *Out, uint32_t Value, uint8_t MinDigits, uint8_t DecPoint)
-{ uint32_t Base; uint8_t Pos, Len=0;
-  for( Pos=10, Base=1000000000; Base; Base/=10, Pos--)
-  { uint8_t Dig;
-    if(Value>=Base)
-    { Dig=Value/Base; Value-=Dig*Base; }
-    else
-    { Dig=0; }
-    if(Pos==DecPoint) { (*Out++)='.'; Len++; }
-    if( (Pos<=MinDigits) || (Dig>0) || (Pos<=DecPoint) )
-    { (*Out++)='0'+Dig; Len++; MinDigits=Pos; }
-    // (*Out)=0;
-  }
-  return Len; }
+{ return Format_Dec(Out, Value, MinDigits, DecPoint, 10); }
 
 uint8_t Format_SignDec(char *Out, int32_t Value, uint8_t MinDigits, uint8_t DecPoint)
 { if(Value<0) { (*Out++)='-'; Value=(-Value); }
@@ -174,27 +164,24 @@ uint8_t Format_Hex( char *Output, uint32_t Word, uint8_t Digits)
 
 // ------------------------------------------------------------------------------------------
 
-uint8_t Format_Latitude(char *Out, int32_t Lat)
-{ uint8_t Len=0;
-  char Sign='N';
-  if(Lat<0) { Sign='S'; Lat=(-Lat); }
-  uint32_t Deg=Lat/600000;
-  Lat -= 600000*Deg;
-  Len+=Format_UnsDec(Out+Len, Deg, 2, 0);
-  Len+=Format_UnsDec(Out+Len, Lat, 6, 4);
-  Out[Len++]=Sign;
+static uint8_t Format_Coord(char *Out, uint32_t Coord, uint8_t DegDigits, char Sign) // [1/600000deg] => DDMM.MMMMs
+{ uint32_t Deg=Coord/600000;
+  Coord -= 600000*Deg;
+  uint8_t Len=Format_UnsDec(Out, Deg, DegDigits, 0);
+  uint32_t Min=Coord/10000; Coord-=10000*Min;                    // MM.MMMM: three pairs and the dot
+  uint32_t Frac=Coord/100;  Coord-=100*Frac;
+  Format_Pair(Out+Len, Min); Out[Len+2]='.';
+  Format_Pair(Out+Len+3, Frac); Format_Pair(Out+Len+5, Coord);
+  Len+=7; Out[Len++]=Sign;
   return Len; }
 
+uint8_t Format_Latitude(char *Out, int32_t Lat)
+{ if(Lat<0) return Format_Coord(Out, -Lat, 2, 'S');
+  return Format_Coord(Out, Lat, 2, 'N'); }
+
 uint8_t Format_Longitude(char *Out, int32_t Lon)
-{ uint8_t Len=0;
-  char Sign='E';
-  if(Lon<0) { Sign='W'; Lon=(-Lon); }
-  uint32_t Deg=Lon/600000;
-  Lon -= 600000*Deg;
-  Len+=Format_UnsDec(Out+Len, Deg, 3, 0);
-  Len+=Format_UnsDec(Out+Len, Lon, 6, 4);
-  Out[Len++]=Sign;
-  return Len; }
+{ if(Lon<0) return Format_Coord(Out, -Lon, 3, 'W');
+  return Format_Coord(Out, Lon, 3, 'E'); }
 
 // ------------------------------------------------------------------------------------------
 
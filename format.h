@@ -40,6 +40,158 @@ uint8_t Format_HHMMSS(char *Out, uint32_t Time);
 uint8_t Format_Latitude (char *Out, int32_t Lat); // [1/600000deg] =>  DDMM.MMMMs
 uint8_t Format_Longitude(char *Out, int32_t Lon); // [1/600000deg] => DDDMM.MMMMs
 
+uint8_t Format_DecPos(char *Out, uint32_t Value, uint8_t MinDigits, uint8_t DecPoint, uint8_t Positions); // the decimal kernel over Positions digit positions:
+uint8_t Format_DecPos(char *Out, uint64_t Value, uint8_t MinDigits, uint8_t DecPoint, uint8_t Positions); // 5 for 16-bit, 10 for 32-bit, 20 for 64-bit values
+
+// ------------------------------------------------------------------------------------------
+// Sinks: the Format_* below are templates on the sink class, thus the writes inline into the caller
+// and the numbers go out as one block each. A sink has Write(char) and Write(const char *, uint8_t).
+
+template <class Sink>
+ class Format_Sink                                        // base of the sinks: the Format_* templates match only these
+{ public:
+   Sink &getSink(void) { return *static_cast<Sink *>(this); }
+} ;
+
+class Format_BufferSink: public Format_Sink<Format_BufferSink> // into a buffer, bounds-checked
+{ public:
+   char    *Data;
+   uint16_t MaxLen;
+   uint16_t Len;
+   uint8_t  Overflow;                                     // some characters did not fit and were dropped
+
+  public:
+   Format_BufferSink(char *Buffer, uint16_t Size) { Data=Buffer; MaxLen=Size; Clear(); }
+   void Clear(void) { Len=0; Overflow=0; }
+   void Write(char Char) { if(Len<MaxLen) Data[Len++]=Char; else Overflow=1; }
+   void Write(const char *Block, uint8_t Size)
+   { if(Len+Size>MaxLen) { Size=MaxLen-Len; Overflow=1; }
+     for(uint8_t Idx=0; Idx<Size; Idx++) Data[Len++]=Block[Idx]; }
+} ;
+
+class Format_CountSink: public Format_Sink<Format_CountSink> // only counts: the length before formatting for real
+{ public:
+   uint32_t Count;
+
+  public:
+   Format_CountSink() { Count=0; }
+   void Write(char) { Count++; }
+   void Write(const char *, uint8_t Size) { Count+=Size; }
+} ;
+
+class Format_BlockSink: public Format_Sink<Format_BlockSink> // to a block writer, like CONS_UART_WriteBlock() or Log_WriteBlock(): a FIFO commit per block
+{ public:
+   void (*Output)(const char *Data, uint8_t Len);
+
+  public:
+   Format_BlockSink(void (*Block)(const char *Data, uint8_t Len)) { Output=Block; }
+   void Write(char Char) { (*Output)(&Char, 1); }
+   void Write(const char *Block, uint8_t Size) { (*Output)(Block, Size); }
+} ;
+
+class Format_FuncSink: public Format_Sink<Format_FuncSink> // to a per-character function: the former callback API goes through this one
+{ public:
+   void (*Output)(char);
+
+  public:
+   Format_FuncSink(void (*Char)(char)) { Output=Char; }
+   void Write(char Char) { (*Output)(Char); }
+   void Write(const char *Block, uint8_t Size) { for( ; Size; Size--) (*Output)(*Block++); }
+} ;
+
+template <class First, class Second>
+ class Format_TeeSink: public Format_Sink< Format_TeeSink<First, Second> > // to two sinks, like the console and the log
+{ public:
+   First  &One;
+   Second &Two;
+
+  public:
+   Format_TeeSink(First &Sink1, Second &Sink2): One(Sink1), Two(Sink2) { }
+   void Write(char Char) { One.Write(Char); Two.Write(Char); }
+   void Write(const char *Block, uint8_t Size) { One.Write(Block, Size); Two.Write(Block, Size); }
+} ;
+
+template <class Sink>
+ inline void Format_Bytes(Format_Sink<Sink> &Out, const char *Bytes, uint8_t Len) { Out.getSink().Write(Bytes, Len); }
+template <class Sink>
+ inline void Format_Bytes(Format_Sink<Sink> &Out, const uint8_t *Bytes, uint8_t Len) { Out.getSink().Write((const char *)Bytes, Len); }
+
+template <class Sink>
+ inline void Format_NewLine(Format_Sink<Sink> &Out)
+{
+#ifdef WITH_AUTOCR
+  Out.getSink().Write("\r\n", 2);
+#else
+  Out.getSink().Write('\n');
+#endif
+}
+
+template <class Sink>
+ void Format_String(Format_Sink<Sink> &Out, const char *String) // runs between the line ends go out as blocks
+{ for( ; ; )
+  { uint8_t Len=0;
+    while(Len<255 && String[Len] && String[Len]!='\n') Len++;
+    if(Len) Out.getSink().Write(String, Len);
+    String+=Len;
+    if(String[0]==0) break;
+    if(String[0]=='\n') { Format_NewLine(Out); String++; }
+  }
+}
+
+template <class Sink>
+ void Format_String(Format_Sink<Sink> &Out, const char *String, uint8_t MinLen, uint8_t MaxLen)
+{ if(MaxLen<MinLen) MaxLen=MinLen;
+  uint8_t Idx=0;
+  for( ; ; )
+  { uint8_t Len=0;
+    while(Idx+Len<MaxLen && String[Idx+Len] && String[Idx+Len]!='\n') Len++;
+    if(Len) Out.getSink().Write(String+Idx, Len);
+    Idx+=Len;
+    if(Idx>=MaxLen || String[Idx]==0) break;
+    Format_NewLine(Out); Idx++; }
+  for( ; Idx<MinLen; Idx++) Out.getSink().Write(' ');
+}
+
+template <class Sink>
+ inline void Format_Hex(Format_Sink<Sink> &Out, uint8_t  Byte) { char Hex[2]; Out.getSink().Write(Hex, Format_Hex(Hex, Byte)); }
+template <class Sink>
+ inline void Format_Hex(Format_Sink<Sink> &Out, uint16_t Word) { char Hex[4]; Out.getSink().Write(Hex, Format_Hex(Hex, Word)); }
+template <class Sink>
+ inline void Format_Hex(Format_Sink<Sink> &Out, uint32_t Word) { char Hex[8]; Out.getSink().Write(Hex, Format_Hex(Hex, Word)); }
+
+template <class Sink, uint8_t Size>
+ inline void Format_DecBlock(Format_Sink<Sink> &Out, const char (&Dec)[Size], uint8_t Len) // the length bounded by the digit buffer
+{ Out.getSink().Write(Dec, Len<Size ? Len:Size); }
+
+template <class Sink>
+ inline void Format_UnsDec(Format_Sink<Sink> &Out, uint16_t Value, uint8_t MinDigits=1, uint8_t DecPoint=0)
+{ char Dec[8]; Format_DecBlock(Out, Dec, Format_DecPos(Dec, (uint32_t)Value, MinDigits, DecPoint, 5)); }
+template <class Sink>
+ inline void Format_SignDec(Format_Sink<Sink> &Out, int16_t Value, uint8_t MinDigits=1, uint8_t DecPoint=0)
+{ char Dec[8]; Dec[0] = Value<0 ? '-':'+';
+  uint16_t Abs = Value<0 ? -Value:Value;
+  Format_DecBlock(Out, Dec, 1+Format_DecPos(Dec+1, (uint32_t)Abs, MinDigits, DecPoint, 5)); }
+
+template <class Sink>
+ inline void Format_UnsDec(Format_Sink<Sink> &Out, uint32_t Value, uint8_t MinDigits=1, uint8_t DecPoint=0)
+{ char Dec[12]; Format_DecBlock(Out, Dec, Format_DecPos(Dec, Value, MinDigits, DecPoint, 10)); }
+template <class Sink>
+ inline void Format_SignDec(Format_Sink<Sink> &Out, int32_t Value, uint8_t MinDigits=1, uint8_t DecPoint=0)
+{ char Dec[13]; Dec[0] = Value<0 ? '-':'+';
+  uint32_t Abs = Value<0 ? -(uint32_t)Value:Value;
+  Format_DecBlock(Out, Dec, 1+Format_DecPos(Dec+1, Abs, MinDigits, DecPoint, 10)); }
+
+template <class Sink>
+ inline void Format_UnsDec(Format_Sink<Sink> &Out, uint64_t Value, uint8_t MinDigits=1, uint8_t DecPoint=0)
+{ char Dec[22]; Format_DecBlock(Out, Dec, Format_DecPos(Dec, Value, MinDigits, DecPoint, 20)); }
+template <class Sink>
+ inline void Format_SignDec(Format_Sink<Sink> &Out, int64_t Value, uint8_t MinDigits=1, uint8_t DecPoint=0)
+{ char Dec[23]; Dec[0] = Value<0 ? '-':'+';
+  uint64_t Abs = Value<0 ? -(uint64_t)Value:Value;
+  Format_DecBlock(Out, Dec, 1+Format_DecPos(Dec+1, Abs, MinDigits, DecPoint, 20)); }
+
+// ------------------------------------------------------------------------------------------
+
 int8_t  Read_Hex1(char Digit);
 
 int8_t  Read_Dec1(char Digit);                  // convert single digit into an integer
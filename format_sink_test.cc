@@ -0,0 +1,199 @@
+// g++ -std=gnu++14 -O2 -DWITH_AUTOCR -I. -o format_sink_test format_sink_test.cc format.cpp nmea.cpp
+// arm-none-eabi-g++ -O2 -mcpu=cortex-m3 -mthumb -DWITH_AUTOCR -I. ... : the same source gives DWT cycle counts on the Cortex-M3
+
+// The sink templates of format.h against the per-character callback API: the same characters from every sink,
+// then the time of a typical console printout and of a log line: per-character callbacks into the FIFOs
+// as UART1_Write() and Log_Write() do it against the block sinks as CONS_UART_WriteBlock() and Log_WriteBlock().
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "format.h"
+#include "nmea.h"
+#include "fifo.h"
+
+// ----------------------------------------------------------------------------------------------------------------
+
+#ifdef __arm__
+static volatile uint32_t * const DEMCR      = (volatile uint32_t *)0xE000EDFC;
+static volatile uint32_t * const DWT_CTRL   = (volatile uint32_t *)0xE0001000;
+static volatile uint32_t * const DWT_CYCCNT = (volatile uint32_t *)0xE0001004;
+static void     Timer_Init(void)  { *DEMCR |= 0x01000000; *DWT_CYCCNT=0; *DWT_CTRL |= 1; }
+static uint32_t Timer_Ticks(void) { return *DWT_CYCCNT; }
+static const char *TimerUnit = "CPU cycles";
+#else
+#include <chrono>
+static void     Timer_Init(void)  { }
+static uint64_t Timer_Ticks(void) { return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count(); }
+static const char *TimerUnit = "ns";
+#endif
+
+static uint32_t Random=12345;
+static uint32_t Rand(void) { Random = Random*1103515245+12345; return Random>>8; }
+
+// ----------------------------------------------------------------------------------------------------------------
+// the console and the log as on the tracker: a TxFIFO with the interrupt kick, a log FIFO; drained after each printout
+
+static FIFO<uint8_t, 512> TxFIFO;
+static volatile uint32_t TxKicks;                                  // stands for the TXE interrupt enable
+static void TxKick(void) { TxKicks++; }
+
+static void Cons_Write(char Byte)                                   // as UART1_Write()
+{ if(TxFIFO.isEmpty()) { TxFIFO.Write(Byte); TxKick(); return; }
+  if(TxFIFO.Write(Byte)>0) return;
+  TxKick(); }
+
+static void Cons_WriteBlock(const char *Data, uint8_t Len)         // as UART1_WriteBlock()
+{ if(TxFIFO.Write((const uint8_t *)Data, Len)) TxKick(); }
+
+static FIFO<char, 2048> LogFIFO;
+
+static void Log_Write(char Byte) { LogFIFO.Write(Byte); }          // as Log_Write()
+static void Log_WriteBlock(const char *Data, uint8_t Len) { LogFIFO.Write(Data, Len); } // as Log_WriteBlock()
+
+static char     Drained[1024];
+static uint16_t DrainLen;
+
+static void Drain(void)                                             // what the interrupt and the log writer would take out
+{ DrainLen=0;
+  uint8_t Byte; while(TxFIFO.Read(Byte)) if(DrainLen<sizeof(Drained)) Drained[DrainLen++]=Byte;
+  char *Block; size_t Len;
+  while((Len=LogFIFO.getReadBlock(Block))) LogFIFO.flushReadBlock(Len); }
+
+// ----------------------------------------------------------------------------------------------------------------
+// a typical console printout: the DEBUG_PRINT style of the tasks
+
+struct Record { uint32_t Time; uint16_t Sec; int32_t Alt; int16_t Climb; uint32_t Addr; uint64_t Count; } ;
+
+static void Print(void (*Output)(char), const Record &Rec)         // with the per-character callbacks
+{ Format_String(Output, "ProcBaro: ");
+  Format_UnsDec(Output, Rec.Sec, 3, 1);
+  Format_String(Output, "s -> GPS: ");
+  Format_UnsDec(Output, Rec.Time, 2);
+  Output('.');
+  Format_SignDec(Output, Rec.Alt, 2, 1);
+  Output(' '); Format_SignDec(Output, Rec.Climb, 3, 2);
+  Output(' '); Format_Hex(Output, Rec.Addr);
+  Output(' '); Format_UnsDec(Output, Rec.Count);
+  Format_String(Output, "m\n"); }
+
+template <class Sink>
+ static void Print(Format_Sink<Sink> &Output, const Record &Rec)   // the same with a sink
+{ Format_String(Output, "ProcBaro: ");
+  Format_UnsDec(Output, Rec.Sec, 3, 1);
+  Format_String(Output, "s -> GPS: ");
+  Format_UnsDec(Output, Rec.Time, 2);
+  Output.getSink().Write('.');
+  Format_SignDec(Output, Rec.Alt, 2, 1);
+  Output.getSink().Write(' '); Format_SignDec(Output, Rec.Climb, 3, 2);
+  Output.getSink().Write(' '); Format_Hex(Output, Rec.Addr);
+  Output.getSink().Write(' '); Format_UnsDec(Output, Rec.Count);
+  Format_String(Output, "m\n"); }
+
+static void RandomRecord(Record &Rec)
+{ Rec.Time=Rand()%86400; Rec.Sec=Rand()%600; Rec.Alt=(int32_t)(Rand()%100000)-10000;
+  Rec.Climb=(int16_t)(Rand()%2000)-1000; Rec.Addr=Rand(); Rec.Count=((uint64_t)Rand()<<24)^Rand(); }
+
+// ----------------------------------------------------------------------------------------------------------------
+
+static char Captured[256]; static uint16_t CapLen;
+static void Capture(char Char) { if(CapLen<sizeof(Captured)) Captured[CapLen++]=Char; }
+
+static int Compare(const char *Ref, int RefLen, const Format_BufferSink &Buff)
+{ return Buff.Len!=RefLen || Buff.Overflow || memcmp(Ref, Buff.Data, RefLen) ? 1:0; }
+
+template <class Type>
+ static int CheckUnsDec(Type Value)
+{ int Err=0;
+  for(uint8_t MinDigits=0; MinDigits<=22; MinDigits+=3)
+  for(uint8_t DecPoint=0; DecPoint<=22; DecPoint+=2)
+  { char Buffer[64]; Format_BufferSink Buff(Buffer, sizeof(Buffer));
+    CapLen=0; Format_UnsDec(Capture, Value, MinDigits, DecPoint);
+    Format_UnsDec(Buff, Value, MinDigits, DecPoint);
+    Err+=Compare(Captured, CapLen, Buff); }
+  return Err; }
+
+template <class Type>
+ static int CheckSignDec(Type Value)
+{ int Err=0;
+  for(uint8_t MinDigits=0; MinDigits<=22; MinDigits+=3)
+  for(uint8_t DecPoint=0; DecPoint<=22; DecPoint+=2)
+  { char Buffer[64]; Format_BufferSink Buff(Buffer, sizeof(Buffer));
+    CapLen=0; Format_SignDec(Capture, Value, MinDigits, DecPoint);
+    Format_SignDec(Buff, Value, MinDigits, DecPoint);
+    Err+=Compare(Captured, CapLen, Buff); }
+  return Err; }
+
+static int CheckString(const char *String, uint8_t MinLen, uint8_t MaxLen)
+{ char Ref[256], Buffer[256]; Format_BufferSink Buff(Buffer, sizeof(Buffer));
+  Format_String(Buff, String, MinLen, MaxLen);
+  int Err=Compare(Ref, Format_String(Ref, String, MinLen, MaxLen), Buff);
+  Buff.Clear(); Format_String(Buff, String);
+  Err+=Compare(Ref, Format_String(Ref, String), Buff);
+  return Err; }
+
+int main(int argc, char *argv[])
+{ Timer_Init();
+  int Errors=0;
+  for(int Test=0; Test<20000; Test++)
+  { uint32_t Value=Rand()>>(Rand()%24);
+    Errors+=CheckUnsDec((uint16_t)Value); Errors+=CheckSignDec((int16_t)Value);
+    Errors+=CheckUnsDec((uint32_t)Value); Errors+=CheckSignDec((int32_t)(Value-(1<<23)));
+    uint64_t Long=((uint64_t)Rand()<<40)^((uint64_t)Rand()<<16)^Rand(); Long>>=Rand()%56;
+    Errors+=CheckUnsDec(Long); Errors+=CheckSignDec((int64_t)Long-((int64_t)1<<40)); }
+  Errors+=CheckSignDec((int16_t)-32768); Errors+=CheckSignDec((int32_t)0x80000000); Errors+=CheckUnsDec((uint64_t)0xFFFFFFFFFFFFFFFFULL);
+  const char *Strings[] = { "", "\n", "abc", "line one\nline two\n", "\n\nx\n", "no line end at all, but long enough to be cut somewhere" } ;
+  for(int Idx=0; Idx<6; Idx++)
+    for(uint8_t MinLen=0; MinLen<40; MinLen+=3)
+      for(uint8_t MaxLen=0; MaxLen<60; MaxLen+=7)
+        Errors+=CheckString(Strings[Idx], MinLen, MaxLen);
+  for(int Test=0; Test<1000; Test++)                                // every sink gives the same printout
+  { Record Rec; RandomRecord(Rec);
+    CapLen=0; Print(Capture, Rec);
+    char Buffer[256]; Format_BufferSink Buff(Buffer, sizeof(Buffer)); Print(Buff, Rec);
+    Errors+=Compare(Captured, CapLen, Buff);
+    Format_CountSink Count; Print(Count, Rec);
+    if(Count.Count!=CapLen) Errors++;
+    Format_BlockSink Cons(Cons_WriteBlock), Log(Log_WriteBlock);
+    Format_TeeSink<Format_BlockSink, Format_BlockSink> Both(Cons, Log);
+    Drain(); Print(Both, Rec);
+    if(LogFIFO.Full()!=CapLen) Errors++;
+    Drain();
+    if(DrainLen!=CapLen || memcmp(Drained, Captured, CapLen)) Errors++; }
+  { char Buffer[8]; Format_BufferSink Buff(Buffer, sizeof(Buffer)); // a buffer sink does not write past its end
+    Format_String(Buff, "0123456789");
+    if(Buff.Len!=8 || !Buff.Overflow) Errors++; }
+  printf("%d differences between the sinks and the callback API\n", Errors);
+
+  const int Records=256; static Record Rec[Records];
+  for(int Idx=0; Idx<Records; Idx++) RandomRecord(Rec[Idx]);
+  const int Loops=200; uint64_t Ticks[6];
+  uint64_t Start=Timer_Ticks();
+  for(int Loop=0; Loop<Loops; Loop++) for(int Idx=0; Idx<Records; Idx++)
+  { Print(Cons_Write, Rec[Idx]); Drain(); }
+  Ticks[0]=(uint32_t)(Timer_Ticks()-Start); Start=Timer_Ticks();
+  for(int Loop=0; Loop<Loops; Loop++) for(int Idx=0; Idx<Records; Idx++)
+  { Format_BlockSink Cons(Cons_WriteBlock); Print(Cons, Rec[Idx]); Drain(); }
+  Ticks[1]=(uint32_t)(Timer_Ticks()-Start); Start=Timer_Ticks();
+  for(int Loop=0; Loop<Loops; Loop++) for(int Idx=0; Idx<Records; Idx++)
+  { Print(Log_Write, Rec[Idx]); Drain(); }
+  Ticks[2]=(uint32_t)(Timer_Ticks()-Start); Start=Timer_Ticks();
+  for(int Loop=0; Loop<Loops; Loop++) for(int Idx=0; Idx<Records; Idx++)
+  { Format_BlockSink Log(Log_WriteBlock); Print(Log, Rec[Idx]); Drain(); }
+  Ticks[3]=(uint32_t)(Timer_Ticks()-Start); Start=Timer_Ticks();
+  for(int Loop=0; Loop<Loops; Loop++) for(int Idx=0; Idx<Records; Idx++)    // a sentence to both, as SendNMEA() does
+  { NMEA_Builder NMEA; NMEA.Start("POGNB"); NMEA.Comma(); NMEA.UnsDec(Rec[Idx].Sec, 3, 1); NMEA.Comma(); NMEA.SignDec(Rec[Idx].Alt, 2, 1); NMEA.Finish();
+    NMEA.Send(Cons_Write); NMEA.Send(Log_Write); Drain(); }
+  Ticks[4]=(uint32_t)(Timer_Ticks()-Start); Start=Timer_Ticks();
+  for(int Loop=0; Loop<Loops; Loop++) for(int Idx=0; Idx<Records; Idx++)
+  { NMEA_Builder NMEA; NMEA.Start("POGNB"); NMEA.Comma(); NMEA.UnsDec(Rec[Idx].Sec, 3, 1); NMEA.Comma(); NMEA.SignDec(Rec[Idx].Alt, 2, 1); NMEA.Finish();
+    Format_BlockSink Cons(Cons_WriteBlock), Log(Log_WriteBlock); NMEA.Send(Cons); NMEA.Send(Log); Drain(); }
+  Ticks[5]=(uint32_t)(Timer_Ticks()-Start);
+  double Calls=(double)Loops*Records;
+  printf("[%s per printout]      callback   sink\n", TimerUnit);
+  printf("console (incl. drain): %8.1f %8.1f\n", Ticks[0]/Calls, Ticks[1]/Calls);
+  printf("log     (incl. drain): %8.1f %8.1f\n", Ticks[2]/Calls, Ticks[3]/Calls);
+  printf("$POGNB console+log:    %8.1f %8.1f\n", Ticks[4]/Calls, Ticks[5]/Calls);
+  return Errors ? 1:0; }
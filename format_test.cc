@@ -0,0 +1,265 @@
+// g++ -std=gnu++14 -O2 -I. -o format_test format_test.cc format.cpp nmea.cpp ldpc.cpp bitcount.cpp
+// arm-none-eabi-g++ -O2 -mcpu=cortex-m3 -mthumb -I. ... : the same source gives DWT cycle counts on the Cortex-M3
+
+// The digit-pair Format_UnsDec/SignDec/Latitude/Longitude/HHMMSS against the former per-digit division versions
+// (kept here as the reference): the same characters for every MinDigits/DecPoint over a wide range of values,
+// then the time per call and per $POGNT and $PFLAA sentence of both versions.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "format.h"
+#include "nmea.h"
+#include "ogn.h"
+
+// ----------------------------------------------------------------------------------------------------------------
+// the former versions from format.cpp
+
+static uint8_t Ref_UnsDec(char *Out, uint32_t Value, uint8_t MinDigits=1, uint8_t DecPoint=0)
+{ uint32_t Base; uint8_t Pos, Len=0;
+  for( Pos=10, Base=1000000000; Base; Base/=10, Pos--)
+  { uint8_t Dig;
+    if(Value>=Base)
+    { Dig=Value/Base; Value-=Dig*Base; }
+    else
+    { Dig=0; }
+    if(Pos==DecPoint) { (*Out++)='.'; Len++; }
+    if( (Pos<=MinDigits) || (Dig>0) || (Pos<=DecPoint) )
+    { (*Out++)='0'+Dig; Len++; MinDigits=Pos; }
+  }
+  return Len; }
+
+static uint8_t Ref_SignDec(char *Out, int32_t Value, uint8_t MinDigits=1, uint8_t DecPoint=0)
+{ if(Value<0) { (*Out++)='-'; Value=(-Value); }
+         else { (*Out++)='+'; }
+  return 1+Ref_UnsDec(Out, Value, MinDigits, DecPoint); }
+
+template <class Type>
+ static void Ref_UnsDec(void (*Output)(char), Type Value, uint8_t MinDigits, uint8_t DecPoint, uint8_t Positions)
+{ Type Base=1; for(uint8_t Pos=1; Pos<Positions; Pos++) Base*=10;
+  for(uint8_t Pos=Positions; Base; Base/=10, Pos--)
+  { uint8_t Dig;
+    if(Value>=Base)
+    { Dig=Value/Base; Value-=Dig*Base; }
+    else
+    { Dig=0; }
+    if(Pos==DecPoint) (*Output)('.');
+    if( (Pos<=MinDigits) || (Dig>0) || (Pos<=DecPoint) )
+    { (*Output)('0'+Dig); MinDigits=Pos; }
+  }
+}
+
+static uint8_t Ref_Latitude(char *Out, int32_t Lat)
+{ uint8_t Len=0;
+  char Sign='N';
+  if(Lat<0) { Sign='S'; Lat=(-Lat); }
+  uint32_t Deg=Lat/600000;
+  Lat -= 600000*Deg;
+  Len+=Ref_UnsDec(Out+Len, Deg, 2, 0);
+  Len+=Ref_UnsDec(Out+Len, Lat, 6, 4);
+  Out[Len++]=Sign;
+  return Len; }
+
+static uint8_t Ref_Longitude(char *Out, int32_t Lon)
+{ uint8_t Len=0;
+  char Sign='E';
+  if(Lon<0) { Sign='W'; Lon=(-Lon); }
+  uint32_t Deg=Lon/600000;
+  Lon -= 600000*Deg;
+  Len+=Ref_UnsDec(Out+Len, Deg, 3, 0);
+  Len+=Ref_UnsDec(Out+Len, Lon, 6, 4);
+  Out[Len++]=Sign;
+  return Len; }
+
+static uint8_t Ref_HHMMSS(char *Out, uint32_t Time)
+{ uint32_t DayTime=Time%86400;
+  uint32_t Hour=DayTime/3600; DayTime-=Hour*3600;
+  uint32_t Min=DayTime/60; DayTime-=Min*60;
+  uint32_t Sec=DayTime;
+  uint32_t HHMMSS = 10000*Hour + 100*Min + Sec;
+  return Ref_UnsDec(Out, HHMMSS, 6); }
+
+// ----------------------------------------------------------------------------------------------------------------
+// the sentences as OGN_RxPacket::WritePOGNT() and OGN_Packet::WritePFLAA() produce them, with either formatter
+
+struct New_Format
+{ static uint8_t UnsDec (char *Out, uint32_t Value, uint8_t MinDigits=1, uint8_t DecPoint=0) { return Format_UnsDec (Out, Value, MinDigits, DecPoint); }
+  static uint8_t SignDec(char *Out,  int32_t Value, uint8_t MinDigits=1, uint8_t DecPoint=0) { return Format_SignDec(Out, Value, MinDigits, DecPoint); }
+  static uint8_t Latitude (char *Out, int32_t Lat) { return Format_Latitude (Out, Lat); }
+  static uint8_t Longitude(char *Out, int32_t Lon) { return Format_Longitude(Out, Lon); } } ;
+
+struct Ref_Format
+{ static uint8_t UnsDec (char *Out, uint32_t Value, uint8_t MinDigits=1, uint8_t DecPoint=0) { return Ref_UnsDec (Out, Value, MinDigits, DecPoint); }
+  static uint8_t SignDec(char *Out,  int32_t Value, uint8_t MinDigits=1, uint8_t DecPoint=0) { return Ref_SignDec(Out, Value, MinDigits, DecPoint); }
+  static uint8_t Latitude (char *Out, int32_t Lat) { return Ref_Latitude (Out, Lat); }
+  static uint8_t Longitude(char *Out, int32_t Lon) { return Ref_Longitude(Out, Lon); } } ;
+
+template <class Fmt>
+ static uint8_t POGNT(char *NMEA, const OGN_RxPacket &Rx)
+{ const OGN_Packet &Packet = Rx.Packet;
+  uint8_t Len=0;
+  Len+=Format_String(NMEA+Len, "$POGNT,");
+  if(Packet.Position.Time<60) Len+=Fmt::UnsDec(NMEA+Len, Packet.Position.Time, 2);
+  NMEA[Len++]=',';
+  NMEA[Len++]=HexDigit(Packet.Position.AcftType); NMEA[Len++]=',';
+  NMEA[Len++]='0'+Packet.Header.AddrType; NMEA[Len++]=',';
+  uint32_t Addr = Packet.Header.Address;
+  Len+=Format_Hex(NMEA+Len, (uint8_t)(Addr>>16)); Len+=Format_Hex(NMEA+Len, (uint16_t)Addr); NMEA[Len++]=',';
+  NMEA[Len++]='0'+Packet.Header.RelayCount; NMEA[Len++]=',';
+  NMEA[Len++]='0'+Packet.Position.FixQuality; NMEA[Len++]='0'+Packet.Position.FixMode; NMEA[Len++]=',';
+  Len+=Fmt::UnsDec(NMEA+Len, Packet.DecodeDOP()+10, 2, 1); NMEA[Len++]=',';
+  Len+=Fmt::Latitude(NMEA+Len, Packet.DecodeLatitude()); NMEA[Len++]=',';
+  Len+=Fmt::Longitude(NMEA+Len, Packet.DecodeLongitude()); NMEA[Len++]=',';
+  Len+=Fmt::UnsDec(NMEA+Len, Packet.DecodeAltitude()); NMEA[Len++]=',';
+  if(Packet.hasBaro()) Len+=Fmt::SignDec(NMEA+Len, Packet.getBaroAltDiff());
+  NMEA[Len++]=',';
+  Len+=Fmt::SignDec(NMEA+Len, Packet.DecodeClimbRate(), 2, 1); NMEA[Len++]=',';
+  Len+=Fmt::UnsDec(NMEA+Len, Packet.DecodeSpeed(), 2, 1); NMEA[Len++]=',';
+  Len+=Fmt::UnsDec(NMEA+Len, Packet.DecodeHeading(), 4, 1); NMEA[Len++]=',';
+  Len+=Fmt::SignDec(NMEA+Len, Packet.DecodeTurnRate(), 2, 1); NMEA[Len++]=',';
+  Len+=Fmt::SignDec(NMEA+Len, -(int16_t)Rx.RxRSSI/2); NMEA[Len++]=',';
+  Len+=Fmt::UnsDec(NMEA+Len, Rx.RxErr);
+  Len+=NMEA_AppendCheckCRNL(NMEA, Len);
+  NMEA[Len]=0;
+  return Len; }
+
+template <class Fmt>
+ static uint8_t PFLAA(char *NMEA, const OGN_Packet &Packet, int32_t LatDist, int32_t LonDist, int32_t AltDist)
+{ uint8_t Len=0;
+  Len+=Format_String(NMEA+Len, "$PFLAA,"); NMEA[Len++]='0'; NMEA[Len++]=',';
+  Len+=Fmt::SignDec(NMEA+Len, LatDist); NMEA[Len++]=',';
+  Len+=Fmt::SignDec(NMEA+Len, LonDist); NMEA[Len++]=',';
+  Len+=Fmt::SignDec(NMEA+Len, AltDist); NMEA[Len++]=',';
+  NMEA[Len++]='0'+Packet.Header.AddrType; NMEA[Len++]=',';
+  uint32_t Addr = Packet.Header.Address;
+  Len+=Format_Hex(NMEA+Len, (uint8_t)(Addr>>16)); Len+=Format_Hex(NMEA+Len, (uint16_t)Addr); NMEA[Len++]=',';
+  Len+=Fmt::UnsDec(NMEA+Len, Packet.DecodeHeading(), 4, 1); NMEA[Len++]=',';
+  Len+=Fmt::SignDec(NMEA+Len, Packet.DecodeTurnRate(), 2, 1); NMEA[Len++]=',';
+  Len+=Fmt::UnsDec(NMEA+Len, Packet.DecodeSpeed(), 2, 1); NMEA[Len++]=',';
+  Len+=Fmt::SignDec(NMEA+Len, Packet.DecodeClimbRate(), 2, 1); NMEA[Len++]=',';
+  NMEA[Len++]=HexDigit(Packet.Position.AcftType);
+  Len+=NMEA_AppendCheckCRNL(NMEA, Len);
+  NMEA[Len]=0;
+  return Len; }
+
+// ----------------------------------------------------------------------------------------------------------------
+
+#ifdef __arm__
+static volatile uint32_t * const DEMCR      = (volatile uint32_t *)0xE000EDFC;
+static volatile uint32_t * const DWT_CTRL   = (volatile uint32_t *)0xE0001000;
+static volatile uint32_t * const DWT_CYCCNT = (volatile uint32_t *)0xE0001004;
+static void     Timer_Init(void)  { *DEMCR |= 0x01000000; *DWT_CYCCNT=0; *DWT_CTRL |= 1; }
+static uint32_t Timer_Ticks(void) { return *DWT_CYCCNT; }
+static const char *TimerUnit = "CPU cycles";
+#else
+#include <chrono>
+static void     Timer_Init(void)  { }
+static uint64_t Timer_Ticks(void) { return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count(); }
+static const char *TimerUnit = "ns";
+#endif
+
+static volatile uint32_t Sink;                          // keeps the compiler from removing the loops
+
+static uint32_t Random=12345;
+static uint32_t Rand(void) { Random = Random*1103515245+12345; return Random>>8; }
+
+static char Captured[32]; static uint8_t CapLen;         // what the Output function versions produce
+static void Capture(char Char) { if(CapLen<sizeof(Captured)) Captured[CapLen++]=Char; }
+
+static int CheckValue(uint32_t Value)                    // every MinDigits/DecPoint for this value
+{ int Err=0;
+  for(uint8_t MinDigits=0; MinDigits<=12; MinDigits++)
+   for(uint8_t DecPoint=0; DecPoint<=12; DecPoint++)
+   { char New[32], Ref[32];
+     uint8_t NewLen=Format_UnsDec(New, Value, MinDigits, DecPoint);
+     uint8_t RefLen=Ref_UnsDec(Ref, Value, MinDigits, DecPoint);
+     if(NewLen!=RefLen || memcmp(New, Ref, NewLen)) Err++;
+     NewLen=Format_SignDec(New, -(int32_t)(Value>>1), MinDigits, DecPoint);
+     RefLen=Ref_SignDec(Ref, -(int32_t)(Value>>1), MinDigits, DecPoint);
+     if(NewLen!=RefLen || memcmp(New, Ref, NewLen)) Err++;
+     CapLen=0; Ref_UnsDec(Capture, Value, MinDigits, DecPoint, 10); RefLen=CapLen; memcpy(Ref, Captured, CapLen);
+     CapLen=0; Format_UnsDec(Capture, Value, MinDigits, DecPoint);
+     if(CapLen!=RefLen || memcmp(Captured, Ref, RefLen)) Err++;
+     uint16_t Short=Value;
+     CapLen=0; Ref_UnsDec(Capture, Short, MinDigits, DecPoint, 5); RefLen=CapLen; memcpy(Ref, Captured, CapLen);
+     CapLen=0; Format_UnsDec(Capture, Short, MinDigits, DecPoint);
+     if(CapLen!=RefLen || memcmp(Captured, Ref, RefLen)) Err++;
+     uint64_t Long=(uint64_t)Value*Value*(MinDigits+1);
+     CapLen=0; Ref_UnsDec(Capture, Long, MinDigits+8, DecPoint, 20); RefLen=CapLen; memcpy(Ref, Captured, CapLen);
+     CapLen=0; Format_UnsDec(Capture, Long, MinDigits+8, DecPoint);
+     if(CapLen!=RefLen || memcmp(Captured, Ref, RefLen)) Err++; }
+  return Err; }
+
+static int CheckCoord(int32_t Coord)
+{ char New[32], Ref[32]; int Err=0;
+  uint8_t NewLen=Format_Latitude(New, Coord), RefLen=Ref_Latitude(Ref, Coord);
+  if(NewLen!=RefLen || memcmp(New, Ref, NewLen)) Err++;
+  NewLen=Format_Longitude(New, Coord); RefLen=Ref_Longitude(Ref, Coord);
+  if(NewLen!=RefLen || memcmp(New, Ref, NewLen)) Err++;
+  return Err; }
+
+static void RandomPacket(OGN_RxPacket &Rx)
+{ OGN_Packet &Pkt = Rx.Packet; Pkt.Clear();
+  Pkt.Header.Address = Rand()&0xFFFFFF; Pkt.Header.AddrType = Rand()%4;
+  Pkt.Position.Time = Rand()%64; Pkt.Position.AcftType = Rand()%16;
+  Pkt.Position.FixQuality = 1; Pkt.Position.FixMode = 1;
+  Pkt.EncodeLatitude ((int32_t)(Rand()%(180*600000))-90*600000);
+  Pkt.EncodeLongitude((int32_t)(Rand()%(360*600000))-180*600000);
+  Pkt.EncodeAltitude(Rand()%5000);
+  if(Rand()%2) Pkt.setBaroAltDiff((int32_t)(Rand()%511)-255); else Pkt.clrBaro();
+  Pkt.EncodeDOP(Rand()%100); Pkt.EncodeSpeed(Rand()%800); Pkt.EncodeHeading(Rand()%3600);
+  Pkt.EncodeClimbRate((int32_t)(Rand()%200)-100); Pkt.EncodeTurnRate((int32_t)(Rand()%200)-100);
+  Rx.RxRSSI = 60+Rand()%120; Rx.RxErr = Rand()%16; }
+
+int main(int argc, char *argv[])
+{ Timer_Init();
+  int Errors=0;
+  for(uint32_t Value=0; Value<=30000; Value++) Errors+=CheckValue(Value);
+  for(uint32_t Base=10; Base && Base<=1000000000; Base*=10)
+  { Errors+=CheckValue(Base-1); Errors+=CheckValue(Base); Errors+=CheckValue(Base+1); }
+  Errors+=CheckValue(0xFFFFFFFF); Errors+=CheckValue(0x80000000);
+  for(int Test=0; Test<20000; Test++) Errors+=CheckValue((Rand()<<8) ^ Rand());
+  for(int32_t Coord=-600000*3; Coord<=600000*3; Coord+=7) Errors+=CheckCoord(Coord);
+  for(int Test=0; Test<200000; Test++) Errors+=CheckCoord((int32_t)(Rand()%(360*600000))-180*600000);
+  for(int32_t Deg=-200; Deg<=200; Deg++) { Errors+=CheckCoord(Deg*600000); Errors+=CheckCoord(Deg*600000-1); }
+  for(uint32_t Time=0; Time<2*86400; Time+=13)
+  { char New[16], Ref[16];
+    if(Format_HHMMSS(New, Time)!=Ref_HHMMSS(Ref, Time) || memcmp(New, Ref, 6)) Errors++; }
+  const int Packets=256; static OGN_RxPacket Packet[Packets]; static int32_t Dist[Packets][3];
+  for(int Idx=0; Idx<Packets; Idx++)
+  { RandomPacket(Packet[Idx]);
+    for(int Axis=0; Axis<3; Axis++) Dist[Idx][Axis]=(int32_t)(Rand()%40000)-20000;
+    char New[128], Ref[128], Real[128];
+    OGN_RxPacket &Rx = Packet[Idx];
+    uint8_t RealLen=Rx.WritePOGNT(Real);
+    if(POGNT<New_Format>(New, Rx)!=RealLen || strcmp(New, Real)) Errors++;
+    if(POGNT<Ref_Format>(Ref, Rx)!=RealLen || strcmp(Ref, Real)) Errors++;
+    RealLen=Rx.Packet.WritePFLAA(Real, 0, Dist[Idx][0], Dist[Idx][1], Dist[Idx][2]);
+    if(PFLAA<New_Format>(New, Rx.Packet, Dist[Idx][0], Dist[Idx][1], Dist[Idx][2])!=RealLen || strcmp(New, Real)) Errors++;
+    if(PFLAA<Ref_Format>(Ref, Rx.Packet, Dist[Idx][0], Dist[Idx][1], Dist[Idx][2])!=RealLen || strcmp(Ref, Real)) Errors++; }
+  printf("%d differences against the former Format_* and the sentences of ogn.h\n", Errors);
+
+  const int Loops=200; uint32_t Sum=0; char Line[128];
+  uint64_t Ticks[6];
+  uint64_t Start=Timer_Ticks();
+  for(int Loop=0; Loop<Loops; Loop++) for(int Idx=0; Idx<Packets; Idx++) Sum+=Ref_UnsDec(Line, Packet[Idx].Packet.DecodeAltitude());
+  Ticks[0]=(uint32_t)(Timer_Ticks()-Start); Start=Timer_Ticks();
+  for(int Loop=0; Loop<Loops; Loop++) for(int Idx=0; Idx<Packets; Idx++) Sum+=Format_UnsDec(Line, (uint32_t)Packet[Idx].Packet.DecodeAltitude());
+  Ticks[1]=(uint32_t)(Timer_Ticks()-Start); Start=Timer_Ticks();
+  for(int Loop=0; Loop<Loops; Loop++) for(int Idx=0; Idx<Packets; Idx++) Sum+=POGNT<Ref_Format>(Line, Packet[Idx]);
+  Ticks[2]=(uint32_t)(Timer_Ticks()-Start); Start=Timer_Ticks();
+  for(int Loop=0; Loop<Loops; Loop++) for(int Idx=0; Idx<Packets; Idx++) Sum+=POGNT<New_Format>(Line, Packet[Idx]);
+  Ticks[3]=(uint32_t)(Timer_Ticks()-Start); Start=Timer_Ticks();
+  for(int Loop=0; Loop<Loops; Loop++) for(int Idx=0; Idx<Packets; Idx++) Sum+=PFLAA<Ref_Format>(Line, Packet[Idx].Packet, Dist[Idx][0], Dist[Idx][1], Dist[Idx][2]);
+  Ticks[4]=(uint32_t)(Timer_Ticks()-Start); Start=Timer_Ticks();
+  for(int Loop=0; Loop<Loops; Loop++) for(int Idx=0; Idx<Packets; Idx++) Sum+=PFLAA<New_Format>(Line, Packet[Idx].Packet, Dist[Idx][0], Dist[Idx][1], Dist[Idx][2]);
+  Ticks[5]=(uint32_t)(Timer_Ticks()-Start);
+  Sink=Sum;
+  double Calls=(double)Loops*Packets;
+  printf("[%s per call]      former   digit-pairs\n", TimerUnit);
+  printf("Format_UnsDec(Alt): %8.1f %8.1f\n", Ticks[0]/Calls, Ticks[1]/Calls);
+  printf("$POGNT sentence:    %8.1f %8.1f\n", Ticks[2]/Calls, Ticks[3]/Calls);
+  printf("$PFLAA sentence:    %8.1f %8.1f\n", Ticks[4]/Calls, Ticks[5]/Calls);
+  return Errors ? 1:0; }
@@ -0,0 +1,33 @@
+// g++ -O2 -I. -o frame_read frame_read.cpp format.cpp nmea.cpp ldpc.cpp bitcount.cpp
+// ./frame_read [console-or-log-file]       (stdin when no file given)
+
+// Reads the console output or an SD log of a tracker with BinOut=1: the binary frames of the received packets
+// are decoded and printed as $POGNT and $PFLAA, the text in between goes through unchanged.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "ogn.h"
+#include "cobs.h"
+
+int main(int argc, char *argv[])
+{ FILE *File = argc>1 ? fopen(argv[1], "rb"):stdin;
+  if(File==0) { printf("Cannot open %s\n", argv[1]); return -1; }
+  COBS_RxFrame Frame; Frame.Clear();
+  int Frames=0, Bad=0;
+  for( ; ; )
+  { int Byte=fgetc(File); if(Byte==EOF) break;
+    int Type=Frame.ProcessByte(Byte);
+    if(Type==1) { putchar(Byte); continue; }
+    if(Type!=2) continue;
+    OGN_RxPacket Packet; uint32_t DayTime; int16_t LatDist, LonDist, AltDist;
+    if(!Packet.ReadFrame(Frame.Data, Frame.Len, DayTime, LatDist, LonDist, AltDist)) { Bad++; continue; }
+    Frames++;
+    char Line[128];
+    printf("%02u:%02u:%02u.%03u ", DayTime/3600000, DayTime/60000%60, DayTime/1000%60, DayTime%1000); // UTC reception time
+    Packet.WritePOGNT(Line); printf("%s", Line);
+    Packet.Packet.WritePFLAA(Line, 0, LatDist, LonDist, AltDist); printf("%s", Line); }
+  if(File!=stdin) fclose(File);
+  fprintf(stderr, "%d frames, %d bad\n", Frames, Bad);
+  return 0; }
@@ -0,0 +1,83 @@
+// g++ -std=gnu++14 -O2 -I. -o frame_test frame_test.cc format.cpp nmea.cpp ldpc.cpp bitcount.cpp
+
+// Binary frames of the received packets (BinOut) against $POGNT+$PFLAA text: every frame must decode back to the same
+// packet and reception data, text in between the frames must go through, corrupt frames must be rejected.
+// Prints the bytes on the wire per packet for both outputs.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "ogn.h"
+#include "cobs.h"
+
+static void RandomPacket(OGN_RxPacket &Packet)                 // a position packet with realistic fields
+{ Packet.Clear();
+  Packet.Packet.HeaderWord=0;
+  Packet.Packet.Header.Address  = rand()&0xFFFFFF;
+  Packet.Packet.Header.AddrType = 1+rand()%3;
+  Packet.Packet.Position.AcftType = 1+rand()%15;
+  Packet.Packet.Position.Time = rand()%60;
+  Packet.Packet.Position.FixQuality = 1;
+  Packet.Packet.Position.FixMode = 1;
+  Packet.Packet.EncodeLatitude(  (int32_t)(47.0*600000) + rand()%60000);
+  Packet.Packet.EncodeLongitude( (int32_t)(17.0*600000) + rand()%60000);
+  Packet.Packet.EncodeAltitude(300+rand()%3000);
+  Packet.Packet.EncodeSpeed(rand()%600);
+  Packet.Packet.EncodeHeading(rand()%3600);
+  Packet.Packet.EncodeClimbRate(rand()%100-50);
+  Packet.Packet.EncodeTurnRate(rand()%100-50);
+  Packet.Packet.EncodeDOP(rand()%30);
+  Packet.RxRSSI = 100+rand()%100;
+  Packet.RxErr  = rand()%15;
+  Packet.RxChan = rand()%2; }
+
+int main(int argc, char *argv[])
+{ const int Packets=10000;
+  srand(1);
+  static uint8_t Stream[Packets*(OGN_RxPacket::FrameMaxLen+32)]; size_t StreamLen=0;
+  static OGN_RxPacket Sent[Packets]; static uint32_t SentTime[Packets]; static int16_t SentDist[Packets][3];
+  size_t TextBytes=0, FrameBytes=0; int TextLines=0;
+  for(int Idx=0; Idx<Packets; Idx++)
+  { OGN_RxPacket &Packet = Sent[Idx]; RandomPacket(Packet);
+    SentTime[Idx]=1500000000+Idx;
+    int32_t LatDist=rand()%20000-10000, LonDist=rand()%20000-10000, AltDist=rand()%2000-1000;
+    SentDist[Idx][0]=LatDist; SentDist[Idx][1]=LonDist; SentDist[Idx][2]=AltDist;
+    char Line[128];
+    TextBytes+=Packet.WritePOGNT(Line);                        // what the text output would send
+    TextBytes+=Packet.Packet.WritePFLAA(Line, 0, LatDist, LonDist, AltDist);
+    uint8_t Len=Packet.WriteFrame(Stream+StreamLen, SentTime[Idx], 200+Idx%1000, LatDist, LonDist, AltDist);
+    StreamLen+=Len; FrameBytes+=Len;
+    if(Idx%10==0)                                              // other sentences still go out as text
+    { StreamLen+=Format_String((char *)Stream+StreamLen, "$POGNR,0,0,,-110.0,0,0,,\r\n"); TextLines++; }
+  }
+
+  int Errors=0, Frames=0, Lines=0, Bad=0;                      // read back the stream
+  COBS_RxFrame Frame; Frame.Clear();
+  for(size_t Ptr=0; Ptr<StreamLen; Ptr++)
+  { int Type=Frame.ProcessByte(Stream[Ptr]);
+    if(Type==1) { if(Stream[Ptr]=='\n') Lines++; continue; }
+    if(Type!=2) continue;
+    OGN_RxPacket Packet; uint32_t DayTime; int16_t LatDist, LonDist, AltDist;
+    if(!Packet.ReadFrame(Frame.Data, Frame.Len, DayTime, LatDist, LonDist, AltDist)) { Bad++; continue; }
+    const OGN_RxPacket &Ref = Sent[Frames];
+    if( memcmp(Packet.Byte(), Ref.Byte(), OGN_Packet::Bytes) || Packet.RxRSSI!=Ref.RxRSSI || Packet.RxErr!=Ref.RxErr
+     || Packet.RxChan!=Ref.RxChan || DayTime!=(SentTime[Frames]%86400)*1000+200+Frames%1000
+     || LatDist!=SentDist[Frames][0] || LonDist!=SentDist[Frames][1] || AltDist!=SentDist[Frames][2] ) Errors++;
+    Frames++; }
+  if(Frames!=Packets || Lines!=TextLines || Bad) Errors++;
+
+  int Rejected=0;                                              // single byte errors must fail the CRC or the COBS
+  for(int Test=0; Test<1000; Test++)
+  { uint8_t Buf[OGN_RxPacket::FrameMaxLen];
+    uint8_t Len=Sent[Test].WriteFrame(Buf, SentTime[Test], 500, 0, 0, 0);
+    Buf[1+rand()%(Len-2)] ^= 1+rand()%255;
+    OGN_RxPacket Packet; uint32_t DayTime; int16_t LatDist, LonDist, AltDist;
+    if(!Packet.ReadFrame(Buf+1, Len-2, DayTime, LatDist, LonDist, AltDist)) Rejected++; }
+  if(Rejected!=1000) Errors++;
+
+  printf("%d frames, %d text lines, %d bad, %d errors, %d of 1000 corrupted frames rejected\n", Frames, Lines, Bad, Errors, Rejected);
+  printf("wire bytes per packet: text %5.1f, binary %5.1f (x%3.1f less)\n",
+         (double)TextBytes/Packets, (double)FrameBytes/Packets, (double)TextBytes/FrameBytes);
+  return Errors ? 1:0; }
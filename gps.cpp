@@ -2,6 +2,7 @@
 #include <stdlib.h>
 
 #include "hal.h"
+#include "systick.h"
 #include "gps.h"
 #include "ctrl.h"
 
@@ -68,6 +69,13 @@ static union
 } GPS_Burst;
                                                                                                    // for the autobaud on the GPS port
 const int GPS_BurstTimeout = 200; // [ms]
+#ifdef WITH_GPS_RX_DMA
+#if defined(WITH_GPS_PPS) && !defined(WITH_PPS_IRQ)
+const uint32_t GPS_RxWaitTicks =  1; // [ms] the PPS line is polled every tick
+#else
+const uint32_t GPS_RxWaitTicks = 10; // [ms] between the bursts only the timeouts are counted, the PPS interrupt takes its own time
+#endif
+#endif
 
 static const uint8_t  BaudRates=7;                                                                 // number of possible baudrates choices
 static       uint8_t  BaudRateIdx=0;                                                               // actual choice
@@ -95,9 +103,8 @@ int16_t GPS_AverageSpeed(void)                        // get average speed based
 
 // ----------------------------------------------------------------------------
 
-static void GPS_PPS_On(void)                          // called on rising edge of PPS
+static void GPS_PPS_On(TickType_t TickCount)          // called on rising edge of PPS, TickCount = [ms] when it came
 { static TickType_t PrevTickCount=0;
-  TickType_t TickCount = xTaskGetTickCount();         // [ms] TickCount now
   TickType_t Delta = TickCount-PrevTickCount;         // [ms] time difference to the previous PPS
   PrevTickCount = TickCount;                          // [ms]
   if(abs((int)Delta-1000)>10) return;                 // [ms] filter out difference away from 1.00sec
@@ -127,6 +134,22 @@ static void GPS_PPS_On(void)                          // called on rising edge o
 static void GPS_PPS_Off(void)                       // called on falling edge of PPS
 { }
 
+#ifdef WITH_PPS_IRQ
+int32_t PPS_IRQ_Correction = 0;                     // [1/16 CPU tick] per second: how much the CPU crystal is fast against the PPS
+
+static volatile TickType_t PPS_IRQ_TickCount;       // [ms] RTOS tick of the last PPS interrupt
+static volatile uint8_t    PPS_IRQ_Count     = 0;   // counts the PPS interrupts
+static          uint8_t    PPS_IRQ_CountSeen = 0;   // the ones the GPS task has handled already
+
+static void GPS_PPS_IRQ(uint32_t TickCount, uint32_t TickTime) // from the PPS interrupt: only take the time, the GPS task does the rest
+{ static uint32_t PrevTickCount=0, PrevTickTime=0;
+  int32_t Error = (int32_t)(TickCount-PrevTickCount-1000)*(int32_t)SysTickPeriod + (int32_t)(TickTime-PrevTickTime); // [CPU tick]
+  PrevTickCount=TickCount; PrevTickTime=TickTime;
+  if(abs(Error)<(int32_t)(SysTickPeriod*10))                      // filter out the missed or false pulses
+    PPS_IRQ_Correction += Error - (PPS_IRQ_Correction>>4);        // average over some 16 seconds
+  PPS_IRQ_TickCount=TickCount; PPS_IRQ_Count++; }
+#endif
+
 // ----------------------------------------------------------------------------
 
 static void GPS_LockStart(void)                     // called when GPS catches a lock
@@ -157,8 +180,8 @@ static void GPS_LockEnd(void)                       // called when GPS looses a
 
 // ----------------------------------------------------------------------------
 
-static void GPS_BurstStart(void)                                           // when GPS starts sending the data on the serial port
-{ Burst_TickCount=xTaskGetTickCount();
+static void GPS_BurstStart(TickType_t Delay=0)                              // when GPS starts sending the data on the serial port
+{ Burst_TickCount=xTaskGetTickCount()-Delay;                               // [ms] Delay = how long ago the first byte came
 #ifdef DEBUG_PRINT
   xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
   Format_UnsDec(CONS_UART_Write, TimeSync_Time()%60);
@@ -646,6 +669,28 @@ static void GPS_MAV(void)                                                  // wh
 
 // ----------------------------------------------------------------------------
 
+static int GPS_ProcessByte(uint8_t Byte)                                  // a byte from the GPS through the NMEA, UBX and MAV catchers
+{ NMEA.ProcessByte(Byte);                                                 // process through the NMEA interpreter
+#ifdef WITH_GPS_UBX
+  UBX.ProcessByte(Byte);
+#endif
+#ifdef WITH_MAVLINK
+  MAV.ProcessByte(Byte);
+#endif
+  if(NMEA.isComplete())                                                   // NMEA completely received ?
+  { int Valid=0;
+    if(NMEA.isChecked()) { GPS_NMEA(); Valid=1; }                         // NMEA check sum is correct ?
+    NMEA.Clear(); return Valid; }
+#ifdef WITH_GPS_UBX
+  if(UBX.isComplete()) { GPS_UBX(); UBX.Clear(); return 1; }
+#endif
+#ifdef WITH_MAVLINK
+  if(MAV.isComplete()) { GPS_MAV(); MAV.Clear(); return 1; }
+#endif
+  return -1; }                                                            // -1 = message not complete, 0 = bad message, 1 = valid message
+
+// ----------------------------------------------------------------------------
+
 #ifdef __cplusplus
   extern "C"
 #endif
@@ -664,7 +709,11 @@ void vTaskGPS(void* pvParameters)
   xSemaphoreGive(CONS_Mutex);
 
   GPS_Burst.Flags=0;
+#ifdef WITH_PPS_IRQ
+  GPS_PPS_IRQ_Callback = GPS_PPS_IRQ;                                    // the PPS interrupt takes the time, the task picks it up
+#else
   bool PPS=0;
+#endif
   int LineIdle=0;                                                        // [ms] counts idle time for the GPS data
   int NoValidData=0;                                                     // [ms] count time without valid data (to decide to change baudrate)
   NMEA.Clear();
@@ -680,7 +729,14 @@ void vTaskGPS(void* pvParameters)
 
   TickType_t RefTick = xTaskGetTickCount();
   for( ; ; )                                                              // main task loop: every milisecond (RTOS time tick)
-  { vTaskDelay(1);                                                        // wait for the next time tick (but apparently it can wait more than one OS tick)
+  {
+#ifdef WITH_GPS_RX_DMA
+    uint32_t WaitTicks = GPS_RxWaitTicks;
+    if(GPS_Burst.Active && !GPS_Burst.Complete) WaitTicks=1;              // inside a burst: look for the GGA/RMC/GSA every tick, the messages can come without gaps
+    int Waiting=GPS_UART_RxWait(WaitTicks);                               // sleep until the GPS line goes idle: the end of a burst or a gap between the messages
+#else
+    vTaskDelay(1);                                                        // wait for the next time tick (but apparently it can wait more than one OS tick)
+#endif
     TickType_t NewTick = xTaskGetTickCount();
     TickType_t Delta = NewTick-RefTick;
     RefTick = NewTick;
@@ -697,36 +753,45 @@ void vTaskGPS(void* pvParameters)
       xSemaphoreGive(CONS_Mutex); }
 #endif
 */
+#ifdef WITH_PPS_IRQ
+    uint8_t PPS_Count=PPS_IRQ_Count;
+    if(PPS_Count!=PPS_IRQ_CountSeen) { PPS_IRQ_CountSeen=PPS_Count; GPS_PPS_On(PPS_IRQ_TickCount); } // PPS came: with the time of its interrupt
+#else
 #ifdef WITH_GPS_PPS
-    if(GPS_PPS_isOn()) { if(!PPS) { PPS=1; GPS_PPS_On();  } }             // monitor GPS PPS signal
+    if(GPS_PPS_isOn()) { if(!PPS) { PPS=1; GPS_PPS_On(xTaskGetTickCount()); } } // monitor GPS PPS signal
                   else { if( PPS) { PPS=0; GPS_PPS_Off(); } }             // and call handling calls
+#endif
 #endif
     LineIdle+=Delta;                                                      // count idle time
     NoValidData+=Delta;                                                   // count time without any valid NMEA nor UBX packet
     uint16_t Bytes=0;
+#ifdef WITH_GPS_RX_DMA
+    if( Waiting && (!GPS_Burst.Active) )                                  // burst started: it started as long ago as the bytes took to come
+    { uint32_t BaudRate=GPS_getBaudRate();
+      uint32_t Load=getSysTick_Reload();
+      int32_t  Frac=((Load-getSysTick_Count())*1000)/(Load+1);            // [us] since the RTOS tick: the delay counts from now, not from the tick
+      int32_t  Delay=(int32_t)((Waiting*100000)/(BaudRate/100))-Frac+500; // [us] rounded to the nearest tick
+      GPS_BurstStart(Delay>0 ? Delay/1000:0);
+      GPS_Burst.Active=1; }
+    for( ; ; )                                                            // loop over the blocks in the GPS DMA buffer
+    { uint8_t *Block; int Len=GPS_UART_ReadBlock(Block); if(Len<=0) break; // received bytes, contiguous in the buffer
+      Bytes+=Len;
+      LineIdle=0;                                                         // if there were bytes: restart idle counting
+      for(int Idx=0; Idx<Len; Idx++)                                      // all messages in the block: no need to wait for the next tick
+      { if(GPS_ProcessByte(Block[Idx])>0) NoValidData=0; }
+      GPS_UART_FlushRead(Len); }
+#else
     uint16_t MaxBytesPerTick = 1+(GPS_getBaudRate()+2500)/5000;
     for( ; ; )                                                            // loop over bytes in the GPS UART buffer
     { uint8_t Byte; int Err=GPS_UART_Read(Byte); if(Err<=0) break;        // get Byte from serial port, if no bytes then break this loop
       Bytes++;
       LineIdle=0;                                                         // if there was a byte: restart idle counting
-      NMEA.ProcessByte(Byte);                                             // process through the NMEA interpreter
-#ifdef WITH_GPS_UBX
-      UBX.ProcessByte(Byte);
-#endif
-#ifdef WITH_MAVLINK
-      MAV.ProcessByte(Byte);
-#endif
-      if(NMEA.isComplete())                                               // NMEA completely received ?
-      { if(NMEA.isChecked()) { GPS_NMEA(); NoValidData=0; }               // NMEA check sum is correct ?
-        NMEA.Clear(); break; }
-#ifdef WITH_GPS_UBX
-      if(UBX.isComplete()) { GPS_UBX(); NoValidData=0; UBX.Clear(); break; }
-#endif
-#ifdef WITH_MAVLINK
-      if(MAV.isComplete()) { GPS_MAV(); NoValidData=0; MAV.Clear(); break; }
-#endif
+      int Valid=GPS_ProcessByte(Byte);
+      if(Valid>0) NoValidData=0;
+      if(Valid>=0) break;                                                 // one message per time tick
       if(Bytes>=MaxBytesPerTick) break;
     }
+#endif
 /*
 #ifdef DEBUG_PRINT
     if(Bytes)
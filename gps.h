@@ -34,6 +34,10 @@ typedef union
 
 extern Status GPS_Status;
 
+#ifdef WITH_PPS_IRQ
+extern int32_t PPS_IRQ_Correction;          // [1/16 CPU tick] per second: how much the CPU crystal is fast against the GPS PPS
+#endif
+
 uint32_t GPS_getBaudRate(void);             // [bps]
 
 GPS_Position *GPS_getPosition(void);
@@ -0,0 +1,261 @@
+// g++ -std=gnu++14 -O2 -I. -o gps_rx_dma_test gps_rx_dma_test.cc format.cpp nmea.cpp ldpc.cpp bitcount.cpp
+// the UART, the DMA channel and the RTOS tick are simulated: the test runs on the host only
+
+// Replay of recorded GPS bursts through the two ways vTaskGPS() can receive them:
+// - the RXNE interrupt per byte into the 32-byte RxFIFO, the task polls it every RTOS tick and takes at most one message per tick
+// - the DMA into the circular buffer of uart_dma.h, the task sleeps until the idle-line or the half/full buffer interrupt
+// The bytes come at 115200 bps with the timing of a u-blox receiver, the messages go through the real NMEA_RxMsg
+// and the burst logic of gps.cpp: the time from the last byte of the GGA/RMC/GSA set to the position being ready,
+// the error of the burst start time (which GPS_BurstComplete() gives to TimeSync_SoftPPS() without a PPS)
+// and the interrupts and task wake-ups per burst are printed for both.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nmea.h"
+#include "fifo.h"
+#include "uart_dma.h"
+
+static uint32_t Random=12345;
+static uint32_t Rand(void) { Random = Random*1103515245+12345; return Random>>8; }
+
+// ----------------------------------------------------------------------------------------------------------------
+// one burst as recorded from a u-blox NEO-6M at 1Hz: the check-sums are appended below
+
+static const char *Burst[] =
+{ "$GPRMC,101723.00,A,4715.18534,N,01945.37821,E,12.412,271.43,140917,,,A",
+  "$GPVTG,271.43,T,,M,12.412,N,22.987,K,A",
+  "$GPGGA,101723.00,4715.18534,N,01945.37821,E,1,09,0.97,1453.2,M,40.1,M,,",
+  "$GPGSA,A,3,02,05,06,07,09,13,20,29,30,,,,1.71,0.97,1.41",
+  "$GPGSV,4,1,14,02,38,296,42,05,64,210,45,06,10,309,33,07,22,052,38",
+  "$GPGSV,4,2,14,09,18,104,36,13,47,269,44,15,02,328,,20,10,183,31",
+  "$GPGSV,4,3,14,23,07,137,,29,27,225,40,30,42,071,43,36,29,157,39",
+  "$GPGSV,4,4,14,41,31,140,,49,36,184,38",
+  "$GPGLL,4715.18534,N,01945.37821,E,101723.00,A,A",
+  0 } ;
+
+static const uint32_t BaudRate = 115200;
+static const int64_t  ByteTime = 10000000000LL/BaudRate;           // [ns] start + 8 data + stop bits
+static const int64_t  TickTime = 1000000;                          // [ns] RTOS tick
+
+static const int      Bursts   = 300;                              // [sec] of data
+
+static uint8_t  Byte[Bursts*800];                                  // the bytes on the line
+static int64_t  Time[Bursts*800];                                  // [ns] when each came out of the UART receiver
+static int      Bytes;
+static int64_t  FirstByte[Bursts];                                 // [ns] start bit of the first byte of the burst
+static int64_t  LastByte[Bursts];                                  // [ns] the CR of the message which completed GGA+RMC+GSA
+static int      Sentences;
+
+static void Record(void)                                           // lay out the bursts on the time line
+{ for(int Idx=0; Idx<Bursts; Idx++)
+  { int64_t Now = Idx*1000*TickTime + 80000000 + Rand()%1000000;   // [ns] the burst starts some 80ms after the PPS
+    FirstByte[Idx]=Now;
+    bool RMC=0, GGA=0, GSA=0;
+    for(int Msg=0; Burst[Msg]; Msg++)
+    { char Line[100]; strcpy(Line, Burst[Msg]);
+      uint8_t Check=0; for(int Pos=1; Line[Pos]; Pos++) Check^=Line[Pos];
+      sprintf(Line+strlen(Line), "*%02X\r\n", Check);
+      for(int Pos=0; Line[Pos]; Pos++)
+      { Now+=ByteTime; Byte[Bytes]=Line[Pos]; Time[Bytes]=Now; Bytes++;
+        if(Line[Pos]=='\r' && !(RMC && GGA && GSA))
+        { if(memcmp(Line+3, "RMC", 3)==0) RMC=1;
+          if(memcmp(Line+3, "GGA", 3)==0) GGA=1;
+          if(memcmp(Line+3, "GSA", 3)==0) GSA=1;
+          if(RMC && GGA && GSA) LastByte[Idx]=Now; }
+      }
+      Sentences++;
+      if(Rand()%3==0) Now+=ByteTime*(2+Rand()%20); }               // sometimes a short gap between the messages
+  }
+}
+
+// ----------------------------------------------------------------------------------------------------------------
+// the receiving side of gps.cpp: the NMEA catcher and the burst flags
+
+ class GPS_Receiver
+{ public:
+   NMEA_RxMsg NMEA;
+   bool       Active, GxRMC, GxGGA, GxGSA, Complete;
+   int64_t    LastData;                                            // [ns] when the last bytes were seen
+   int        Valid;                                               // valid messages
+   int        Ready;                                               // bursts with the position ready
+   int64_t    Latency[Bursts];                                     // [ns] from the last byte to the position ready
+   int        Starts;                                              // bursts started
+   int64_t    StartError[Bursts];                                  // [ns] Burst_TickCount against the first byte
+   int        Wakes;                                               // task wake-ups
+
+  public:
+   void Clear(void) { NMEA.Clear(); Active=0; GxRMC=0; GxGGA=0; GxGSA=0; Complete=0; LastData=0; Valid=0; Ready=0; Starts=0; Wakes=0; }
+
+   int ProcessByte(uint8_t Byte)                                   // as GPS_ProcessByte()
+   { NMEA.ProcessByte(Byte);
+     if(!NMEA.isComplete()) return -1;
+     int OK=0;
+     if(NMEA.isChecked())
+     { OK=1; Valid++;
+       if(NMEA.isGxRMC()) GxRMC=1;
+       if(NMEA.isGxGGA()) GxGGA=1;
+       if(NMEA.isGxGSA()) GxGSA=1; }
+     NMEA.Clear(); return OK; }
+
+   void BurstLogic(int64_t Now, int NewBytes, int64_t Start)       // after the bytes of a tick or of a wake-up, Start = GPS_BurstStart() time
+   { if(NewBytes)
+     { if( (!Active) && Starts<Bursts ) { StartError[Starts]=Start-FirstByte[Starts]; Starts++; }
+       LastData=Now; Active=1;
+       if( (!Complete) && GxGGA && GxRMC && GxGSA )
+       { Complete=1; if(Ready<Bursts) { Latency[Ready]=Now-LastByte[Ready]; Ready++; } }
+     }
+     else if(Now-LastData>=200*TickTime)                           // GPS_BurstTimeout
+     { Active=0; GxRMC=0; GxGGA=0; GxGSA=0; Complete=0; }
+   }
+
+   void Print(const char *Name) const
+   { int64_t Sum=0, Max=0;
+     for(int Idx=0; Idx<Ready; Idx++) { Sum+=Latency[Idx]; if(Latency[Idx]>Max) Max=Latency[Idx]; }
+     int64_t ErrSum=0, ErrMax=0;
+     for(int Idx=0; Idx<Starts; Idx++) { int64_t Err=StartError[Idx]; if(Err<0) Err=(-Err); ErrSum+=Err; if(Err>ErrMax) ErrMax=Err; }
+     printf("%-28s %5d bursts ready, last byte to position: %7.3f ms average, %7.3f ms max, %6.1f task wake-ups/burst\n",
+            Name, Ready, Ready?1e-6*Sum/Ready:0.0, 1e-6*Max, (double)Wakes/Bursts);
+     printf("%28s burst start time error: %7.3f ms average, %7.3f ms max\n", "", Starts?1e-6*ErrSum/Starts:0.0, 1e-6*ErrMax); }
+
+   double AverageLatency(void) const
+   { int64_t Sum=0; for(int Idx=0; Idx<Ready; Idx++) Sum+=Latency[Idx];
+     return Ready?(double)Sum/Ready:0; }
+
+   int64_t MaxStartError(void) const
+   { int64_t Max=0;
+     for(int Idx=0; Idx<Starts; Idx++) { int64_t Err=StartError[Idx]; if(Err<0) Err=(-Err); if(Err>Max) Max=Err; }
+     return Max; }
+
+} ;
+
+static int64_t TaskDelay(void) { return Rand()%100000; }           // [ns] other tasks and interrupts delay the GPS task
+
+// ----------------------------------------------------------------------------------------------------------------
+// RXNE per byte into the RxFIFO, the task polls it every tick: one message per tick, MaxBytesPerTick
+
+static GPS_Receiver Poll;
+
+static int ReplayPolling(void)                                      // returns the bytes lost on the RxFIFO overflow
+{ FIFO<uint8_t, 32> RxFIFO; RxFIFO.Clear();
+  Poll.Clear();
+  int Lost=0, Next=0;
+  uint16_t MaxBytesPerTick = 1+(BaudRate+2500)/5000;
+  int64_t End = Time[Bytes-1]+300*TickTime;
+  for(int64_t Tick=1; Tick*TickTime<End; Tick++)
+  { int64_t Now = Tick*TickTime + TaskDelay();                     // vTaskDelay(1)
+    Poll.Wakes++;
+    for( ; Next<Bytes && Time[Next]<=Now; Next++)                  // the RXNE interrupts which came meanwhile
+    { if(RxFIFO.Write(Byte[Next])<=0) Lost++; }
+    uint16_t Count=0;
+    for( ; ; )
+    { uint8_t Byte; if(RxFIFO.Read(Byte)<=0) break;
+      Count++;
+      int Valid=Poll.ProcessByte(Byte);
+      if(Valid>=0) break;                                          // one message per time tick
+      if(Count>=MaxBytesPerTick) break; }
+    Poll.BurstLogic(Now, Count, Tick*TickTime);                    // xTaskGetTickCount() in GPS_BurstStart()
+  }
+  return Lost; }
+
+// ----------------------------------------------------------------------------------------------------------------
+// the DMA into the circular buffer, the task sleeps until the idle line, the half/full buffer or the timeout
+
+static const uint16_t RxDMA_Size = 256;
+
+static GPS_Receiver Idle;
+
+static int ReplayIdleLine(uint32_t WaitTicks, int &IRQs)           // returns the bytes lost on the buffer overrun
+{ static UART_RxDMA<RxDMA_Size> RxDMA; RxDMA.Clear();
+  static int64_t Event[Bursts*800]; int Events=0;                   // the interrupts: idle line, half and full buffer
+  for(int Idx=0; Idx<Bytes; Idx++)
+  { if( ((Idx+1)%(RxDMA_Size/2))==0 ) Event[Events++]=Time[Idx];   // half/complete transfer
+    int64_t IdleTime=Time[Idx]+ByteTime;                            // the idle flag comes a character time after the last byte
+    if( Idx+1==Bytes || Time[Idx+1]>IdleTime ) Event[Events++]=IdleTime; }
+  IRQs=Events;
+  Idle.Clear();
+  int Next=0, NextEvent=0; uint32_t Received=0;
+  int64_t Now = 0;
+  int64_t End = Time[Bytes-1]+300*TickTime;
+  while(Now<End)
+  { uint32_t Ticks = (Idle.Active && !Idle.Complete) ? 1 : WaitTicks; // inside a burst: look for the GGA/RMC/GSA every tick
+    int64_t Wake = (Now/TickTime+Ticks)*TickTime;                    // ulTaskNotifyTake() timeout
+    for( ; NextEvent<Events && Event[NextEvent]<=Now; NextEvent++); // events during the processing: the count makes the wait return at once
+    if(NextEvent<Events && Event[NextEvent]<Wake) Wake=Event[NextEvent];
+    Now = (Wake>Now ? Wake : Now) + TaskDelay();
+    Idle.Wakes++;
+    for( ; Next<Bytes && Time[Next]<=Now; Next++)                  // the DMA writes meanwhile
+    { RxDMA.Data[Received%RxDMA_Size]=Byte[Next]; Received++;
+      if(Received%RxDMA_Size==0) RxDMA.Laps++; }                    // transfer-complete interrupt
+    uint16_t Remain = RxDMA_Size-(Received%RxDMA_Size);             // the DMA count register
+    RxDMA.Overrun(Remain, RxDMA.Laps);                              // as UARTn_RxRemain()
+    int Waiting=RxDMA.Full(Remain);
+    int64_t Frac  = (Now%TickTime)/1000;                            // [us] since the RTOS tick, from the SysTick counter
+    int64_t Delay = (Waiting*100000)/(BaudRate/100)-Frac+500;       // [us] as in vTaskGPS()
+    int64_t Start = (Now/TickTime - (Delay>0 ? Delay/1000:0))*TickTime; // as GPS_BurstStart(Delay)
+    int Count=0;
+    for( ; ; )
+    { uint8_t *Block; int Len=RxDMA.getReadBlock(Block, Remain); if(Len<=0) break;
+      Count+=Len;
+      for(int Idx=0; Idx<Len; Idx++) Idle.ProcessByte(Block[Idx]);
+      RxDMA.flushReadBlock(Len); }
+    Idle.BurstLogic(Now, Count, Start);
+  }
+  return RxDMA.Lost; }
+
+// ----------------------------------------------------------------------------------------------------------------
+// the reader now and then stalls for longer than the buffer lasts: the overruns have to be counted
+// and what the reader gets afterwards has to be the fresh data, not what the DMA was writing over
+
+static uint8_t StreamByte(uint32_t Pos) { return (Pos*2654435761u)>>24; } // the content tells the position in the stream
+
+static bool CheckOverrun(void)
+{ static UART_RxDMA<RxDMA_Size> RxDMA; RxDMA.Clear();
+  uint32_t Received=0, Read=0, Dropped=0, Corrupt=0; int Stalls=0;
+  for(int Step=0; Step<2000; Step++)
+  { int New = Rand()%(RxDMA_Size/2);
+    if(Step%50==49) { New=RxDMA_Size+Rand()%RxDMA_Size; Dropped+=New; Stalls++; } // the reader is late: all it has not read is gone
+    for(int Idx=0; Idx<New; Idx++)                                  // the DMA writes meanwhile
+    { RxDMA.Data[Received%RxDMA_Size]=StreamByte(Received); Received++;
+      if(Received%RxDMA_Size==0) RxDMA.Laps++; }                    // transfer-complete interrupt
+    uint16_t Remain = RxDMA_Size-(Received%RxDMA_Size);
+    RxDMA.Overrun(Remain, RxDMA.Laps);                              // as UARTn_RxRemain()
+    for( ; ; )
+    { uint8_t *Block; int Len=RxDMA.getReadBlock(Block, Remain); if(Len<=0) break;
+      for(int Idx=0; Idx<Len; Idx++) if(Block[Idx]!=StreamByte(RxDMA.ReadCount+Idx)) Corrupt++;
+      RxDMA.flushReadBlock(Len); Read+=Len; }
+  }
+  printf("DMA buffer overruns:         %5d stalls, %d of %d bytes dropped (%d expected), %d bytes read wrong\n",
+         Stalls, RxDMA.Lost, Received, Dropped, Corrupt);
+  return (RxDMA.Lost==Dropped) && (Read+RxDMA.Lost==Received) && (Corrupt==0); }
+
+// ----------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{ Record();
+  printf("%d bursts, %d messages, %d bytes at %d bps\n", Bursts, Sentences, Bytes, BaudRate);
+
+  int PollLost=ReplayPolling();
+  Poll.Print("RXNE + 1ms polling:");
+  printf("%28s %5.1f interrupts/burst, %d bytes lost, %d valid messages\n", "", (double)Bytes/Bursts, PollLost, Poll.Valid);
+  double PollLatency=Poll.AverageLatency();
+
+  bool OK = (Poll.Ready==Bursts) && (Poll.Valid==Sentences) && (PollLost==0);
+
+  static const uint32_t WaitTicks[2] = { 1, 10 } ;                 // with the PPS polled every tick and with the PPS interrupt or no PPS
+  for(int Wait=0; Wait<2; Wait++)
+  { int IRQs=0;
+    int IdleLost=ReplayIdleLine(WaitTicks[Wait], IRQs);
+    char Name[32]; sprintf(Name, "DMA + idle line, %2dms wait:", WaitTicks[Wait]);
+    Idle.Print(Name);
+    printf("%28s %5.1f interrupts/burst, %d bytes lost, %d valid messages\n", "", (double)IRQs/Bursts, IdleLost, Idle.Valid);
+    OK = OK && (Idle.Ready==Bursts) && (Idle.Valid==Sentences) && (IdleLost==0) && (Idle.AverageLatency()<PollLatency)
+            && (Idle.MaxStartError()<=Poll.MaxStartError());
+  }
+
+  OK = CheckOverrun() && OK;
+
+  printf("%s\n", OK?"OK":"FAILED");
+  return OK?0:1; }
@@ -597,21 +597,33 @@ void UART_Configuration(int CONS_BaudRate, int GPS_BaudRate)
 #ifdef WITH_SWAP_UARTS
 int  CONS_UART_Read  (uint8_t &Byte)  { return UART2_Read (Byte); }
 void CONS_UART_Write (char     Byte)  {        UART2_Write(Byte); }
+void CONS_UART_WriteBlock(const char *Data, uint8_t Len) { UART2_WriteBlock(Data, Len); }
 int  CONS_UART_Free  (void)           { return UART2_Free(); }
 int  CONS_UART_Full  (void)           { return UART2_Full(); }
 void CONS_UART_SetBaudrate(int BaudRate) { UART2_SetBaudrate(BaudRate); }
 int   GPS_UART_Read  (uint8_t &Byte)  { return UART1_Read (Byte); }
 void  GPS_UART_Write (char     Byte)  {        UART1_Write(Byte); }
 void  GPS_UART_SetBaudrate(int BaudRate) { UART1_SetBaudrate(BaudRate); }
+#ifdef WITH_GPS_RX_DMA
+int   GPS_UART_ReadBlock(uint8_t *&Block) { return UART1_ReadBlock(Block); }
+void  GPS_UART_FlushRead(int Len)         {        UART1_FlushRead(Len); }
+int   GPS_UART_RxWait(uint32_t Ticks)     { return UART1_RxWait(Ticks); }
+#endif
 #else
 int  CONS_UART_Read  (uint8_t &Byte)  { return UART1_Read (Byte); }
 void CONS_UART_Write (char     Byte)  {        UART1_Write(Byte); }
+void CONS_UART_WriteBlock(const char *Data, uint8_t Len) { UART1_WriteBlock(Data, Len); }
 int  CONS_UART_Free  (void)           { return UART1_Free(); }
 int  CONS_UART_Full  (void)           { return UART1_Full(); }
 void CONS_UART_SetBaudrate(int BaudRate) { UART1_SetBaudrate(BaudRate); }
 int   GPS_UART_Read  (uint8_t &Byte)  { return UART2_Read (Byte); }
 void  GPS_UART_Write (char     Byte)  {        UART2_Write(Byte); }
 void  GPS_UART_SetBaudrate(int BaudRate) { UART2_SetBaudrate(BaudRate); }
+#ifdef WITH_GPS_RX_DMA
+int   GPS_UART_ReadBlock(uint8_t *&Block) { return UART2_ReadBlock(Block); }
+void  GPS_UART_FlushRead(int Len)         {        UART2_FlushRead(Len); }
+int   GPS_UART_RxWait(uint32_t Ticks)     { return UART2_RxWait(Ticks); }
+#endif
 #endif
 
 // -------------------------------------------------------------------------------------------------------
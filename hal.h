@@ -89,12 +89,18 @@ extern SemaphoreHandle_t CONS_Mutex; // console port Mutex
 
 int  CONS_UART_Read       (uint8_t &Byte); // non-blocking
 void CONS_UART_Write      (char     Byte); // blocking
+void CONS_UART_WriteBlock (const char *Data, uint8_t Len); // blocking, one FIFO commit per block
 int  CONS_UART_Free       (void);          // how many bytes can be written to the transmit buffer
 int  CONS_UART_Full       (void);          // how many bytes already in the transmit buffer
 void CONS_UART_SetBaudrate(int BaudRate);
 int   GPS_UART_Read       (uint8_t &Byte); // non-blocking
 void  GPS_UART_Write      (char     Byte); // blocking
 void  GPS_UART_SetBaudrate(int BaudRate);
+#ifdef WITH_GPS_RX_DMA
+int   GPS_UART_ReadBlock  (uint8_t *&Block); // non-blocking: received bytes which are contiguous in the buffer
+void  GPS_UART_FlushRead  (int Len);         // after GPS_UART_ReadBlock()
+int   GPS_UART_RxWait     (uint32_t Ticks);  // sleep until the GPS line goes idle: returns the number of bytes waiting
+#endif
 
 void LED_PCB_Flash(uint8_t Time);     // [ms] turn on the PCB LED for a given time
 #ifdef WITH_LED_RX
@@ -18,13 +18,27 @@
 #include <avr/pgmspace.h>
 #endif
 
-// extern const uint32_t LDPC_ParityGen_n208k160[48][5];
-// extern const uint32_t LDPC_ParityCheck_n208k160[48][7];
-// extern const uint8_t  LDPC_ParityCheckIndex_n208k160[48][24];
-// extern const uint8_t  LDPC_BitWeight_n208k160[208];
+#ifndef LDPC_ENCODE_TABLE        // 0 = encode by popcount over the ParityGen rows, 4 = nibble table (3.8KB), 8 = byte table (30KB)
+#if defined(__arm__) || defined(__AVR__)
+#define LDPC_ENCODE_TABLE 0      // flash is small on the MCU: select a table with WITH_OPTS += ldpc_enc4 or ldpc_enc8
+#else
+#define LDPC_ENCODE_TABLE 8      // on the host take the fastest
+#endif
+#endif
+
+#ifndef __AVR__
+#include "ldpc_code.h"
+
+typedef LDPC_Code<LDPC_n208k160> LDPC_Code_n208k160;
+                                                  // the tables under their old names, all derived from LDPC_n208k160::ParityCheck
+static constexpr const uint32_t (&LDPC_ParityCheck_n208k160)[48][7] = LDPC_n208k160::ParityCheck;
+static constexpr const auto &LDPC_ParityCheckIndex_n208k160 = LDPC_Code_n208k160::Table.RowIndex;
+static constexpr const auto &LDPC_ParityGen_n208k160        = LDPC_Code_n208k160::Table.ParityGen;
 #ifdef WITH_PPM
-extern const uint32_t LDPC_ParityGen_n354k160[194][5];
-extern const uint32_t LDPC_ParityCheck_n354k160[194][12];
+typedef LDPC_Code<LDPC_n354k160> LDPC_Code_n354k160;
+static constexpr const uint32_t (&LDPC_ParityCheck_n354k160)[194][12] = LDPC_n354k160::ParityCheck;
+static constexpr const auto &LDPC_ParityGen_n354k160          = LDPC_Code_n354k160::Table.ParityGen;
+#endif
 #endif
 
 #ifdef __AVR__
@@ -65,6 +79,11 @@ void LDPC_Encode_n354k160(      uint32_t *Data);
 uint8_t LDPC_Check(const uint32_t *Data, const uint32_t *Parity); // Data and Parity are 32-bit words
 uint8_t LDPC_Check(const uint32_t *Data);
 uint8_t LDPC_Check(const uint8_t  *Data);                         // 20 data bytes followed by 6 parity bytes
+#ifdef WITH_LDPC_SYNDROME
+uint64_t LDPC_Syndrome(const uint8_t *Data);                      // 48-bit syndrome: bit #Row is set when parity check #Row fails
+int8_t LDPC_FastCorrect(uint8_t *Data, const uint8_t *Err=0);     // correct up to two bit errors by the syndrome: return number of bits corrected or -1 if not possible
+                                                                  // Err = Manchester errors: the pairs of bits flagged there are preferred
+#endif
 #ifdef WITH_PPM
 uint8_t LDPC_Check_n354k160(const uint32_t *Data, const uint32_t *Parity); // Data and Parity are 32-bit words
 uint8_t LDPC_Check_n354k160(const uint32_t *Data);
@@ -74,23 +93,127 @@ uint8_t LDPC_Check_n354k160(const uint32_t *Data);
 
 #ifndef __AVR__
 
-extern const uint8_t LDPC_ParityCheckIndex_n208k160[48][24];
+// saturating arithmetic of the min-sum decoder: single SSAT/USAT instructions on the Cortex-M3
+inline int16_t LDPC_Sat16(int32_t Value)                  // limit to the int16_t range
+{
+#ifdef __ARM_ARCH_7M__
+  __asm__ ("ssat %0, #16, %1" : "=r" (Value) : "r" (Value)); return Value;
+#else
+  if(Value>32767) return 32767;
+  if(Value<(-32768)) return -32768;
+  return Value;
+#endif
+}
+
+inline int16_t LDPC_Abs15(int32_t Value)                  // absolute value limited to 32767: |-32768| does not wrap
+{ if(Value<0) Value=(-Value);
+#ifdef __ARM_ARCH_7M__
+  __asm__ ("usat %0, #15, %1" : "=r" (Value) : "r" (Value)); return Value;
+#else
+  if(Value>32767) return 32767;
+  return Value;
+#endif
+}
+
+#ifdef WITH_LDPC_CM3
+// Cortex-M3 kernel of LDPC_CodeDecoder::ProcessChecks() for codes with up to 32 bits per check, placed in RAM
+// to avoid the flash wait states. Bit-exact with the portable ProcessChecksGeneric().
+// RowIndex[] = Rows rows of RowStride bytes: number of bits then their indicies, as LDPC_CodeTables::RowIndex
+int8_t LDPC_ProcessChecks_CM3(const int16_t *InpBit, int16_t *ExtBit, int16_t *OutBit,
+                              const uint8_t *RowIndex, uint8_t RowStride, uint8_t Rows, uint8_t Bits);
+
+extern uint32_t LDPC_CM3_Cycles;                          // [CPU cycles] spent in the kernel, counted by the DWT
+extern uint32_t LDPC_CM3_Iter;                            // number of kernel calls (iterations) counted
+void LDPC_CM3_CountCycles(void);                          // enable the DWT cycle counter (does nothing on the host)
+#endif
 
-class LDPC_Decoder
+#ifdef WITH_LDPC_CHASE
+// Chase-style second stage for when the iterations fail: the Bits least reliable bits (smallest |OutBit|,
+// Manchester errors first among equals) are flipped in all combinations, in Gray code order thus every test
+// is a single syndrome update. Of the combinations which clear all checks the one of the least reliability is taken.
+// Tests limits the CPU time spent. Returns the number of bits flipped in OutBit or -1 when nothing was found.
+template <class Code, class Soft>                                    // Soft = int16_t or int8_t a-posteriori bits
+ int8_t LDPC_ChaseCorrect(Soft *OutBit, const uint8_t *Err=0, uint8_t Bits=8, uint16_t Tests=256)
+{ const uint8_t CodeBits=Code::CodeBits; const uint8_t ParityBits=Code::ParityBits;
+  static_assert(ParityBits<=64, "LDPC_ChaseCorrect(): syndrome does not fit 64 bits");
+  const uint8_t MaxBits=16;
+  if(Bits>MaxBits) Bits=MaxBits;
+  uint8_t  Weak[MaxBits];                                           // the least reliable bits
+  uint16_t Cost[MaxBits];                                           // and their cost of flipping, sorted ascending
+  uint8_t  Count=0;
+  for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+  { int16_t Ampl=LDPC_Abs15(OutBit[Bit]);
+    uint16_t BitCost = 2*(uint16_t)Ampl;
+    if( (Err==0) || (Err[Bit>>3]&(1<<(Bit&7)))==0 ) BitCost++;      // Manchester-valid bits are a little more reliable
+    if( (Count==Bits) && (BitCost>=Cost[Count-1]) ) continue;
+    uint8_t Pos = Count<Bits ? Count++ : Count-1;
+    for( ; Pos && Cost[Pos-1]>BitCost; Pos--)
+    { Cost[Pos]=Cost[Pos-1]; Weak[Pos]=Weak[Pos-1]; }
+    Cost[Pos]=BitCost; Weak[Pos]=Bit; }
+  uint64_t Syndrome=0;                                              // which checks fail for the hard decision of OutBit
+  for(uint8_t Row=0; Row<ParityBits; Row++)
+  { const typename Code::Index *CheckIndex = Code::Table.RowIndex[Row];
+    uint8_t CheckWeight = *CheckIndex++; uint8_t Parity=0;
+    for(uint8_t Bit=0; Bit<CheckWeight; Bit++)
+      Parity ^= OutBit[CheckIndex[Bit]]>0;
+    if(Parity) Syndrome |= (uint64_t)1<<Row; }
+  uint64_t Column[MaxBits];                                         // which checks each weak bit is part of
+  for(uint8_t Idx=0; Idx<Count; Idx++)
+  { const uint8_t *ColIndex = Code::Table.ColIndex[Weak[Idx]];
+    uint8_t BitWeight = *ColIndex++; Column[Idx]=0;
+    for(uint8_t Row=0; Row<BitWeight; Row++)
+      Column[Idx] |= (uint64_t)1<<ColIndex[Row]; }
+  uint32_t Flip=0; uint32_t FlipCost=0;
+  uint32_t Best=0; uint32_t BestCost=0xFFFFFFFF;
+  uint32_t Patterns = (uint32_t)1<<Count;
+  for(uint32_t Test=1; (Test<Patterns) && Tests; Test++, Tests--)
+  { uint8_t Idx=__builtin_ctz(Test);                                // Gray code: next pattern differs by a single bit
+    uint32_t Mask=(uint32_t)1<<Idx;
+    Flip^=Mask; Syndrome^=Column[Idx];
+    if(Flip&Mask) FlipCost+=Cost[Idx];
+             else FlipCost-=Cost[Idx];
+    if( (Syndrome==0) && (FlipCost<BestCost) ) { Best=Flip; BestCost=FlipCost; }
+  }
+  if(BestCost==0xFFFFFFFF) return -1;
+  int8_t Flips=0;
+  for(uint8_t Idx=0; Idx<Count; Idx++)
+  { if((Best&((uint32_t)1<<Idx))==0) continue;
+    int16_t Ampl=OutBit[Weak[Idx]];
+    OutBit[Weak[Idx]] = Ampl ? LDPC_Sat16(-(int32_t)Ampl) : 1;
+    Flips++; }
+  return Flips; }
+#endif // WITH_LDPC_CHASE
+
+template <class Def>                                      // integer min-sum decoder for codes up to 255 bits
+ class LDPC_CodeDecoder
 { public:
-   const static uint8_t UserBits   = 160;                 // 5 32-bit bits = 20 bytes
-   const static uint8_t UserWords  = UserBits/32;
-   const static uint8_t ParityBits =  48;                 // 6 bytes (total packet is 26 bytes)
-   const static uint8_t CodeBits   = UserBits+ParityBits; // 160+48 = 208 code bits = 26 bytes
-   const static uint8_t CodeBytes  = (CodeBits+ 7)/ 8;    //
-   const static uint8_t CodeWords  = (CodeBits+31)/32;    //
-   const static uint8_t MaxCheckWeight = 24;
-   // const static uint8_t MaxBitWeight   =  8;
+   typedef LDPC_Code<Def> Code;
+   const static uint8_t UserBits   = Code::UserBits;      // 160 bits = 5 32-bit words = 20 bytes
+   const static uint8_t UserWords  = Code::UserWords;
+   const static uint8_t ParityBits = Code::ParityBits;    // 48 bits = 6 bytes (total packet is 26 bytes)
+   const static uint8_t CodeBits   = Code::CodeBits;      // 160+48 = 208 code bits = 26 bytes
+   const static uint8_t CodeBytes  = Code::CodeBytes;     //
+   const static uint8_t CodeWords  = Code::CodeWords;     //
+   const static uint8_t MaxCheckWeight = Code::MaxCheckWeight;
+   const static uint8_t MaxBitWeight   = Code::MaxBitWeight;
+
+   static_assert(Code::CodeBits<256, "LDPC_CodeDecoder: code too long");
 
   public:
 
    int16_t  InpBit[CodeBits]; // a-priori bits
+#ifdef WITH_LDPC_LAYERED
+   union
+   { int16_t  ExtBit[CodeBits]; // extrinsic inf.: only the flooding schedule needs it
+     struct                     // layered schedule: the check-to-bit messages compressed per row, see ProcessCheckLayered()
+     { int16_t  RowMin1[Code::ParityBits];   // smallest amplitude of the bit-to-check messages (already normalized)
+       int16_t  RowMin2[Code::ParityBits];   // second smallest amplitude
+       uint32_t RowSign[Code::ParityBits];   // bit set => the check-to-bit message is positive, bits #24..28 = position of the smallest
+     } ;
+   } ;
+#else
    int16_t  ExtBit[CodeBits]; // extrinsic inf.
+#endif
    int16_t  OutBit[CodeBits]; // a-posteriori bits
 
    void Input(const uint8_t *Data, const uint8_t *Err)
@@ -103,6 +226,9 @@ class LDPC_Decoder
        OutBit[Bit] = InpBit[Bit] = Inp; ExtBit[Bit]=0;
        Mask<<=1; if(Mask==0) { Idx++; Mask=1; }
      }
+#ifdef WITH_LDPC_LAYERED
+     ClearLayers();
+#endif
    }
 
    void Input(const uint32_t Data[CodeWords])
@@ -112,14 +238,40 @@ class LDPC_Decoder
        ExtBit[Bit]=0;
        Mask<<=1; if(Mask==0) { Word=Data[++Idx]; Mask=1; }
      }
+#ifdef WITH_LDPC_LAYERED
+     ClearLayers();
+#endif
+   }
+
+   void Input(const int8_t Data[CodeBits], int16_t Ampl=128) // soft bits: +1/-1 per vote, 0 for unknown, like summed copies of a packet
+   { for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { OutBit[Bit] = InpBit[Bit] = Data[Bit]*Ampl;
+       ExtBit[Bit]=0; }
+#ifdef WITH_LDPC_LAYERED
+     ClearLayers();
+#endif
+   }
+
+   void Clear(void)                                       // all bits unknown: then addInput() the soft information
+   { for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { OutBit[Bit] = InpBit[Bit] = 0; ExtBit[Bit]=0; }
+#ifdef WITH_LDPC_LAYERED
+     ClearLayers();
+#endif
    }
 
+   void addInput(uint8_t Bit, int16_t Value)              // soft information for a bit: +/-128 is a clean hard bit
+   { OutBit[Bit] = InpBit[Bit] = LDPC_Sat16((int32_t)InpBit[Bit]+Value); }
+
    void Input(const float *Data, float RefAmpl=1.0)
    { for(int Bit=0; Bit<CodeBits; Bit++)
      { int Inp = floor(128*Data[Bit^7]/RefAmpl+0.5);
        if(Inp>32767) Inp=32767; else if(Inp<(-32767)) Inp=(-32767);
        OutBit[Bit] = InpBit[Bit] = Inp;
        ExtBit[Bit]=0; }
+#ifdef WITH_LDPC_LAYERED
+     ClearLayers();
+#endif
    }
 
    void Output(uint32_t Data[CodeWords])
@@ -139,6 +291,14 @@ class LDPC_Decoder
    }
 
    int8_t ProcessChecks(void)
+#ifdef WITH_LDPC_CM3
+   { static_assert(MaxCheckWeight<=32 && sizeof(typename Code::Index)==1, "LDPC_CodeDecoder: code does not fit the Cortex-M3 kernel");
+     return LDPC_ProcessChecks_CM3(InpBit, ExtBit, OutBit, Code::Table.RowIndex[0], MaxCheckWeight+1, ParityBits, CodeBits); }
+#else
+   { return ProcessChecksGeneric(); }
+#endif
+
+   int8_t ProcessChecksGeneric(void)             // portable version: ExtBit and OutBit saturate at the int16_t range
    { for(uint8_t Bit=0; Bit<CodeBits; Bit++)
        ExtBit[Bit]=0;
      uint8_t Count=0;
@@ -148,20 +308,20 @@ class LDPC_Decoder
      // printf("%d parity checks fail\n", Count);
      if(Count==0) return 0;
      for(uint8_t Bit=0; Bit<CodeBits; Bit++)
-     { OutBit[Bit] = InpBit[Bit] + (ExtBit[Bit]>>1); }
+     { OutBit[Bit] = LDPC_Sat16((int32_t)InpBit[Bit] + (ExtBit[Bit]>>1)); }
      return Count; }
 
    int16_t ProcessCheck(uint8_t Row)
    { int16_t MinAmpl=32767; uint8_t MinBit=0; int16_t MinAmpl2=MinAmpl;
      uint32_t Word=0; uint32_t Mask=1;
-     const uint8_t *CheckIndex = LDPC_ParityCheckIndex_n208k160[Row];
+     const uint8_t *CheckIndex = Code::Table.RowIndex[Row];
      uint8_t CheckWeight = *CheckIndex++;
      for(uint8_t Bit=0; Bit<CheckWeight; Bit++)
      { uint8_t BitIdx=CheckIndex[Bit];
-       int16_t Ampl=OutBit[BitIdx];
-       if(Ampl>0) Word|=Mask;
+       int16_t Out=OutBit[BitIdx];
+       if(Out>0) Word|=Mask;
        Mask<<=1;
-       if(Ampl<0) Ampl=(-Ampl);
+       int16_t Ampl=LDPC_Abs15(Out);
        if(Ampl<MinAmpl) { MinAmpl2=MinAmpl; MinAmpl=Ampl; MinBit=Bit; }
        else if(Ampl<MinAmpl2) { MinAmpl2=Ampl; }
      }
@@ -171,75 +331,324 @@ class LDPC_Decoder
      { uint8_t BitIdx=CheckIndex[Bit];
        int16_t Ampl = Bit==MinBit ? MinAmpl2 : MinAmpl;
        if(CheckFails) Ampl=(-Ampl);
-       ExtBit[BitIdx] += (Word&Mask) ? Ampl:-Ampl;
+       ExtBit[BitIdx] = LDPC_Sat16((int32_t)ExtBit[BitIdx] + ((Word&Mask) ? Ampl:-Ampl));
        Mask<<=1; }
      return CheckFails?-MinAmpl:MinAmpl; }
 
+#ifdef WITH_LDPC_CHASE
+   int8_t ChaseCorrect(const uint8_t *Err=0, uint8_t Bits=8, uint16_t Tests=256) // see LDPC_ChaseCorrect()
+   { return LDPC_ChaseCorrect<Code>(OutBit, Err, Bits, Tests); }
+#endif // WITH_LDPC_CHASE
+
+#ifdef WITH_LDPC_LAYERED
+   // layered (row-serial) normalized min-sum: OutBit is updated after every row, thus it converges in about half the iterations.
+   // The row state shares the memory of ExtBit: a decode runs one schedule or the other, Input() or Clear() starts it afresh.
+   uint8_t  PassRun;               // number of consecutive rows which passed with no hard bit flips
+
+   static_assert(sizeof(RowMin1)+sizeof(RowMin2)+sizeof(RowSign)<=sizeof(ExtBit), "LDPC_CodeDecoder: layered state does not fit ExtBit");
+   static_assert(MaxCheckWeight<=24, "LDPC_CodeDecoder: check too wide for the layered schedule");
+
+   void ClearLayers(void)
+   { for(uint8_t Row=0; Row<ParityBits; Row++)
+     { RowMin1[Row]=0; RowMin2[Row]=0; RowSign[Row]=0; }
+     PassRun=0; }
+
+   int8_t ProcessChecksLayered(void) // do one layered iteration, return the number of rows which failed or flipped bits
+   { uint8_t Count=0;                // stops and returns zero as soon as all rows passed with no bit flips in between
+     for(uint8_t Row=0; Row<ParityBits; Row++)
+     { if(ProcessCheckLayered(Row)) { PassRun=0; Count++; continue; }
+       PassRun++; if(PassRun>=ParityBits) return 0; }
+     return Count; }
+
+   bool ProcessCheckLayered(uint8_t Row) // return true when the row fails or any hard bit changed
+   { const uint8_t *CheckIndex = Code::Table.RowIndex[Row];
+     uint8_t CheckWeight = *CheckIndex++;
+     int32_t  Min1=RowMin1[Row]; int32_t Min2=RowMin2[Row];
+     uint32_t Sign=RowSign[Row]; uint8_t MinBit=Sign>>24;
+     int32_t  BitToCheck[MaxCheckWeight];                               // int32_t: no saturation needed on the way
+     int32_t  MinAmpl=0x7FFFFFFF; int32_t MinAmpl2=MinAmpl; uint8_t NewMinBit=0;
+     uint32_t Word=0; uint32_t Par=0; uint32_t Hard=0;
+     for(uint8_t Bit=0; Bit<CheckWeight; Bit++)
+     { int32_t Ampl = Bit==MinBit ? Min2:Min1;                          // take away the old check-to-bit message
+       int32_t Out  = OutBit[CheckIndex[Bit]];
+       Hard |= (uint32_t)(Out>0)<<Bit;                                   // hard bits before the update
+       int32_t Inp  = (Sign>>Bit)&1 ? Out-Ampl : Out+Ampl;
+       BitToCheck[Bit]=Inp;
+       uint32_t Pos = Inp>0; Word|=Pos<<Bit; Par^=Pos;
+       if(Inp<0) Inp=(-Inp);
+       if(Inp<MinAmpl2)
+       { if(Inp<MinAmpl) { MinAmpl2=MinAmpl; MinAmpl=Inp; NewMinBit=Bit; }
+                    else { MinAmpl2=Inp; } }
+     }
+     if(MinAmpl2>32767) MinAmpl2=32767;                                 // the messages are stored as int16_t
+     if(MinAmpl >32767) MinAmpl =32767;
+     MinAmpl  = (MinAmpl *3)>>2;                                        // normalize by 3/4
+     MinAmpl2 = (MinAmpl2*3)>>2;
+     if(Par) Word^=(1<<CheckWeight)-1;                                  // bit set => new message is positive
+     RowMin1[Row]=MinAmpl; RowMin2[Row]=MinAmpl2; RowSign[Row]=Word|((uint32_t)NewMinBit<<24);
+     uint32_t NewHard=0; uint32_t NewPar=0; bool Zero=0;
+     for(uint8_t Bit=0; Bit<CheckWeight; Bit++)
+     { int32_t Ampl = Bit==NewMinBit ? MinAmpl2:MinAmpl;                // add the new check-to-bit message
+       int32_t Out  = (Word>>Bit)&1 ? BitToCheck[Bit]+Ampl : BitToCheck[Bit]-Ampl;
+       Out = LDPC_Sat16(Out);
+       uint32_t Pos = Out>0; NewHard|=Pos<<Bit; NewPar^=Pos; Zero|=Out==0;
+       OutBit[CheckIndex[Bit]]=Out; }
+     return Zero || NewHard!=Hard || NewPar; }                          // undecided, hard bit flipped or the parity check on the hard bits fails
+#endif // WITH_LDPC_LAYERED
+
 } ;
 
-template <class Float=float>
- class LDPC_FloatDecoder
+typedef LDPC_CodeDecoder<LDPC_n208k160> LDPC_Decoder;
+
+// RAM-compact variant: int8 layered normalized min-sum, the extrinsic information is stored in place.
+// OutBit holds the input plus all current check-to-bit messages; a row takes its old message away, computes the new one
+// and adds it back, thus no separate input and extrinsic arrays are needed. The messages themselves are kept compressed
+// per row, like LDPC_CodeDecoder::ProcessChecksLayered() does: about 540 bytes for the n208k160 code instead of 1250.
+template <class Def>
+ class LDPC_CompactDecoder
+{ public:
+   typedef LDPC_Code<Def> Code;
+   const static uint8_t UserBits   = Code::UserBits;
+   const static uint8_t UserWords  = Code::UserWords;
+   const static uint8_t ParityBits = Code::ParityBits;
+   const static uint8_t CodeBits   = Code::CodeBits;
+   const static uint8_t CodeBytes  = Code::CodeBytes;
+   const static uint8_t CodeWords  = Code::CodeWords;
+   const static uint8_t MaxCheckWeight = Code::MaxCheckWeight;
+
+   const static int8_t InpAmpl =  16;     // amplitude of a hard input bit: LDPC_CodeDecoder has 128
+   const static int8_t MaxAmpl = 127;     // saturation: symmetric, thus negation never overflows
+
+   static_assert(Code::CodeBits<256, "LDPC_CompactDecoder: code too long");
+   static_assert(MaxCheckWeight<32, "LDPC_CompactDecoder: check too wide");
+
+  public:
+   int8_t   OutBit[CodeBits];      // a-posteriori bits
+   int8_t   RowMin1[ParityBits];   // smallest amplitude of the bit-to-check messages (already normalized)
+   int8_t   RowMin2[ParityBits];   // second smallest amplitude
+   uint8_t  RowMinBit[ParityBits]; // position (within the row) of the smallest
+   uint32_t RowWord[ParityBits];   // which bit-to-check messages were positive, bit #31 = parity of all of them
+   uint8_t  PassRun;               // number of consecutive rows which passed with no hard bit flips
+
+   static int8_t Saturate(int32_t Value)
+   { if(Value>MaxAmpl) return MaxAmpl;
+     if(Value<(-MaxAmpl)) return -MaxAmpl;
+     return Value; }
+
+   void ClearLayers(void)
+   { for(uint8_t Row=0; Row<ParityBits; Row++)
+     { RowMin1[Row]=0; RowMin2[Row]=0; RowMinBit[Row]=0; RowWord[Row]=0; }
+     PassRun=0; }
+
+   void Input(const uint8_t *Data, const uint8_t *Err)
+   { uint8_t Mask=1; uint8_t Idx=0; uint8_t DataByte=0; uint8_t ErrByte=0;
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { if(Mask==1) { DataByte=Data[Idx];  ErrByte=Err[Idx]; }
+       if(ErrByte&Mask) OutBit[Bit]=0;
+                   else OutBit[Bit]=(DataByte&Mask) ? +InpAmpl:-InpAmpl;
+       Mask<<=1; if(Mask==0) { Idx++; Mask=1; }
+     }
+     ClearLayers(); }
+
+   void Input(const uint32_t Data[CodeWords])
+   { uint32_t Mask=1; uint8_t Idx=0; uint32_t Word=Data[Idx];
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { OutBit[Bit] = (Word&Mask) ? +InpAmpl:-InpAmpl;
+       Mask<<=1; if(Mask==0) { Word=Data[++Idx]; Mask=1; }
+     }
+     ClearLayers(); }
+
+   void Input(const int8_t Data[CodeBits], int16_t Ampl=128) // soft bits, Ampl on the scale of LDPC_CodeDecoder
+   { for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+       OutBit[Bit] = Saturate(((int32_t)Data[Bit]*Ampl*InpAmpl)>>7);
+     ClearLayers(); }
+
+   void Clear(void)                                       // all bits unknown: then addInput() the soft information
+   { for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+       OutBit[Bit]=0;
+     ClearLayers(); }
+
+   void addInput(uint8_t Bit, int16_t Value)              // soft information for a bit, on the scale of LDPC_CodeDecoder
+   { OutBit[Bit] = Saturate(OutBit[Bit] + (((int32_t)Value*InpAmpl)>>7)); }
+
+   void Input(const float *Data, float RefAmpl=1.0)
+   { for(int Bit=0; Bit<CodeBits; Bit++)
+       OutBit[Bit] = Saturate(floor(InpAmpl*Data[Bit^7]/RefAmpl+0.5));
+     ClearLayers(); }
+
+   void Output(uint32_t Data[CodeWords])
+   { uint32_t Mask=1; uint8_t Idx=0; uint32_t Word=0;
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { if(OutBit[Bit]>0) Word|=Mask;
+       Mask<<=1; if(Mask==0) { Data[Idx++]=Word; Word=0; Mask=1; }
+     } if(Mask>1) Data[Idx++]=Word;
+   }
+
+   void Output(uint8_t Data[CodeBytes])
+   { uint8_t Mask=1; uint8_t Idx=0; uint8_t Byte=0;
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { if(OutBit[Bit]>0) Byte|=Mask;
+       Mask<<=1; if(Mask==0) { Data[Idx++]=Byte; Byte=0; Mask=1; }
+     } if(Mask>1) Data[Idx++]=Byte;
+   }
+
+   int8_t ProcessChecks(void)        // do one layered iteration, return the number of rows which failed or flipped bits
+   { uint8_t Count=0;                // stops and returns zero as soon as all rows passed with no bit flips in between
+     for(uint8_t Row=0; Row<ParityBits; Row++)
+     { if(ProcessCheck(Row)) { PassRun=0; Count++; continue; }
+       PassRun++; if(PassRun>=ParityBits) return 0; }
+     return Count; }
+
+   int8_t ProcessChecksLayered(void) { return ProcessChecks(); } // the same interface as LDPC_CodeDecoder for RFM_RxPktData
+
+   bool ProcessCheck(uint8_t Row)    // return true when the row fails or any hard bit changed
+   { const uint8_t *CheckIndex = Code::Table.RowIndex[Row];
+     uint8_t CheckWeight = *CheckIndex++;
+     int8_t   Min1=RowMin1[Row]; int8_t Min2=RowMin2[Row]; uint8_t MinBit=RowMinBit[Row];
+     uint32_t OldSign=RowWord[Row]; if(OldSign&0x80000000) OldSign^=0x7FFFFFFF; // bit set => old message was positive
+     int8_t   BitToCheck[MaxCheckWeight];
+     int8_t   MinAmpl=MaxAmpl; int8_t MinAmpl2=MaxAmpl; uint8_t NewMinBit=0;
+     uint32_t Word=0; uint32_t Mask=1;
+     for(uint8_t Bit=0; Bit<CheckWeight; Bit++)
+     { int8_t Ampl = Bit==MinBit ? Min2:Min1;                         // take away the old check-to-bit message
+       if(((OldSign>>Bit)&1)==0) Ampl=(-Ampl);
+       int8_t Inp = Saturate((int16_t)OutBit[CheckIndex[Bit]]-Ampl);
+       BitToCheck[Bit]=Inp;
+       if(Inp>0) Word|=Mask;
+       Mask<<=1;
+       if(Inp<0) Inp=(-Inp);
+       if(Inp<MinAmpl) { MinAmpl2=MinAmpl; MinAmpl=Inp; NewMinBit=Bit; }
+       else if(Inp<MinAmpl2) { MinAmpl2=Inp; }
+     }
+     MinAmpl  = (MinAmpl *3+2)>>2;                                      // normalize by 3/4, rounded: the amplitudes are small
+     MinAmpl2 = (MinAmpl2*3+2)>>2;
+     if(Count1s(Word)&1) Word|=0x80000000;
+     RowMin1[Row]=MinAmpl; RowMin2[Row]=MinAmpl2; RowMinBit[Row]=NewMinBit; RowWord[Row]=Word;
+     uint32_t Sign=Word; if(Sign&0x80000000) Sign^=0x7FFFFFFF;            // bit set => new message is positive
+     uint8_t Ones=0; bool Fail=0;
+     for(uint8_t Bit=0; Bit<CheckWeight; Bit++)
+     { uint8_t BitIdx=CheckIndex[Bit];
+       int8_t Ampl = Bit==NewMinBit ? MinAmpl2:MinAmpl;                 // add the new check-to-bit message
+       if(((Sign>>Bit)&1)==0) Ampl=(-Ampl);
+       int8_t Out = Saturate((int16_t)BitToCheck[Bit]+Ampl);
+       if((Out>0)!=(OutBit[BitIdx]>0)) Fail=1;                         // hard bit flipped
+       if(Out==0) Fail=1;                                               // or undecided
+       if(Out>0) Ones++;
+       OutBit[BitIdx]=Out; }
+     if(Ones&1) Fail=1;                                                 // or the parity check on the hard bits fails
+     return Fail; }
+
+#ifdef WITH_LDPC_CHASE
+   int8_t ChaseCorrect(const uint8_t *Err=0, uint8_t Bits=8, uint16_t Tests=256) // see LDPC_ChaseCorrect()
+   { return LDPC_ChaseCorrect<Code>(OutBit, Err, Bits, Tests); }
+#endif // WITH_LDPC_CHASE
+
+} ;
+
+typedef LDPC_CompactDecoder<LDPC_n208k160> LDPC_Decoder8;
+
+template <class Float>
+ class LDPC_Arith                                             // arithmetic of the soft decoders: float or double
 { public:
+   typedef Float Acc;                                         // accumulator for the symbol to bit mapping
+   static const bool Scaled = 0;                              // no need to scale the input
+   static Float Max(void)                 { return std::numeric_limits<Float>::max(); }
+   static Float One(void)                 { return 1.0; }   // unit amplitude
+   static Float Feedback(void)            { return 0.33; }  // how much extrinsic inf. goes back into the bits
+   static Float Uniform(int Count)        { return 1.0/Count; }
+   static Float Add(Float A, Float B)     { return A+B; }
+   static Float Neg(Float A)              { return -A; }
+   static Float Mul(Float A, Float B)     { return A*B; }   // A x Feedback
+   static Float Weight(Float Inp, Float Prob) { return Inp*Prob; } // pulse power x symbol probability
+   static Float Square(Float A)           { return A*A; }
+   static int   Headroom(Acc Max)         { return 0; }
+   static Float Reduce(Acc A, int Shift)  { return A; }
+   static void  Rescale(Float *Inp, Float *Out, int Count) { }
+   static void  Normalize(Float *Prob, int Count, Float Norm)
+   { Float Sum=0;
+     for(int Idx=0; Idx<Count; Idx++) Sum+=Prob[Idx];
+     Sum=Norm/Sum;
+     for(int Idx=0; Idx<Count; Idx++) Prob[Idx]*=Sum; }
+} ;
+
+template <>
+ class LDPC_Arith<int16_t>                                    // saturating fixed point for MCUs without FPU:
+{ public:                                                     // amplitudes are Q8 (256 = 1.0), feedback and probabilities Q15
+   typedef int32_t Acc;
+   static const bool Scaled = 1;                              // bit LL are scaled to leave headroom for the decoder
+   static int16_t Saturate(int32_t A)
+   { if(A>32767) return 32767;
+     if(A<(-32767)) return -32767;
+     return A; }
+   static int16_t Max(void)                     { return 32767; }
+   static int16_t One(void)                     { return 256; }
+   static int16_t Feedback(void)                { return 10813; } // 0.33
+   static int16_t Uniform(int Count)            { return Saturate(32768/Count); } // Uniform(1) would be 32768
+   static int16_t Add(int16_t A, int16_t B)     { return Saturate((int32_t)A+B); }
+   static int16_t Neg(int16_t A)                { return -A; }
+   static int16_t Mul(int16_t A, int16_t B)     { return ((int32_t)A*B)>>15; }
+   static int32_t Weight(int16_t Inp, int16_t Prob) { return Saturate(((int32_t)Inp*Prob)>>9); } // uniform 1/64 gives unit gain
+   static int32_t Square(int32_t A)             { return (A*A)>>8; }
+   static int     Headroom(int32_t Max)                                // right shift which brings the largest bit LL to 2048..4095
+   { int Shift=0;
+     if(Max<=0) return Shift;
+     if(Max>=4096)
+     { while((Max>>Shift)>=4096) Shift++; }
+     else
+     { while(Shift>(-8) && (Max<<(-Shift))<2048) Shift--; }
+     return Shift; }
+   static int16_t Reduce(int32_t A, int Shift)  { return Saturate(Shift>=0 ? A>>Shift : A*(1<<(-Shift))); }
+   static void    Rescale(int16_t *Inp, int16_t *Out, int Count)          // halve all bit LL when they grow close to saturation
+   { int16_t Max=0;                                                      // min-sum does not depend on the scale
+     for(int Idx=0; Idx<Count; Idx++)
+     { int16_t Ampl = Out[Idx]<0 ? -Out[Idx]:Out[Idx]; if(Ampl>Max) Max=Ampl; }
+     if(Max<8192) return;
+     for(int Idx=0; Idx<Count; Idx++)
+     { Inp[Idx]>>=1; Out[Idx]>>=1; }
+   }
+   static void    Normalize(int16_t *Prob, int Count, int16_t Norm)
+   { int32_t Sum=0;
+     for(int Idx=0; Idx<Count; Idx++) Sum+=Prob[Idx];
+     if(Sum<=0) return;
+     for(int Idx=0; Idx<Count; Idx++) Prob[Idx] = Saturate(((int32_t)Prob[Idx]*Norm*128)/Sum); } // Norm=One() => sum is 32768, a single one saturates
+} ;
 
-   const static int MaxCodeBits=512;
-   const static int MaxParityBits=256;
-   const static int MaxParityWeight=32;                       //
-   int CodeBits;                                              // number of code bits
-   int ParityBits;                                            // number of parity bits
-   uint16_t ParityCheckIndex[MaxParityBits][MaxParityWeight]; // list of 1's in the ParityCheck matrix
-   uint8_t  ParityCheckRowWeight[MaxParityBits];              // number of 1's in ParityCheck rows
-   uint8_t  ParityCheckColWeight[MaxCodeBits];                // number of 1's in ParityCheck columns
-
-   Float InpBit[MaxCodeBits];                                 // a-priori bits
-   Float ExtBit[MaxCodeBits];                                 // extrinsic inf.
-   Float OutBit[MaxCodeBits];                                 // a-posteriori bits
+template <class Float=float, class Def=LDPC_n208k160>         // Float=int16_t gives the fixed point decoder
+ class LDPC_FloatDecoder
+{ public:
+   typedef LDPC_Code<Def> Code;
+   typedef LDPC_Arith<Float> Arith;
+   const static int CodeBits   = Code::CodeBits;                          // number of code bits
+   const static int ParityBits = Code::ParityBits;                        // number of parity bits
+
+   Float InpBit[CodeBits];                                    // a-priori bits
+   Float ExtBit[CodeBits];                                    // extrinsic inf.
+   Float OutBit[CodeBits];                                    // a-posteriori bits
    Float Feedback;
 
   public:
 
    LDPC_FloatDecoder()
-   { CodeBits=0; ParityBits=0; Feedback=0.33; }
+   { Feedback=Arith::Feedback(); }
 
    void Clear(void)
    { for(int Bit=0; Bit<CodeBits; Bit++)
      { OutBit[Bit] = InpBit[Bit] = ExtBit[Bit]=0; }
    }
 
-   int Configure(int NewCodeBits, int NewParityBits, const uint32_t *PackedParityCheck )
-   { if(CodeBits>MaxCodeBits) return -1;
-     CodeBits=NewCodeBits;
-     if(ParityBits>MaxParityBits) return -1;
-     ParityBits=NewParityBits;
-     for(int Bit=0; Bit<CodeBits; Bit++)
-       ParityCheckColWeight[Bit]=0;
-     const uint32_t *Check=PackedParityCheck;
-     for(int ParBit=0; ParBit<ParityBits; ParBit++)
-     { int RowWeight=0;
-       uint32_t Word=0; uint32_t Mask=0;
-       for(int Bit=0; Bit<CodeBits; Bit++)
-       { if(Mask==0) { Mask=1; Word=(*Check++); }
-         if(Word&Mask)
-         { ParityCheckIndex[ParBit][RowWeight++]=Bit;
-           ParityCheckColWeight[Bit]++; }
-         Mask<<=1;
-       }
-       ParityCheckRowWeight[ParBit]=RowWeight;
-     }
-     return 1; }
-
    void PrintConfig(void) const
    { printf("LDPC_FloatDecoder[%d,%d] Check index table:\n", CodeBits, ParityBits);
      for(int ParBit=0; ParBit<ParityBits; ParBit++)
-     { printf("Check[%3d]:", ParityCheckRowWeight[ParBit]);
-       for(int Bit=0; Bit<ParityCheckRowWeight[ParBit]; Bit++)
-       { printf(" %3d", ParityCheckIndex[ParBit][Bit]); }
+     { printf("Check[%3d]:", Code::Table.RowIndex[ParBit][0]);
+       for(int Bit=0; Bit<Code::Table.RowIndex[ParBit][0]; Bit++)
+       { printf(" %3d", Code::Table.RowIndex[ParBit][1+Bit]); }
        printf("\n");
      }
      printf("ColWeight[%d]:\n", CodeBits);
      int Bit;
      for(Bit=0; Bit<CodeBits; Bit++)
      { if((Bit&0x1F)==0x00) printf("%03d:", Bit);
-       printf(" %d", ParityCheckColWeight[Bit]);
+       printf(" %d", Code::Table.ColIndex[Bit][0]);
        if((Bit&0x1F)==0x1F) printf("\n"); }
      if((Bit&0x1F)!=0x00) printf("\n");
    }
@@ -248,30 +657,30 @@ template <class Float=float>
    { printf("OutBit[%d]\n", CodeBits);
      for(int Bit=0; Bit<CodeBits; Bit++)
      { if((Bit&0xF)==0x0) printf("%03d:", Bit);
-       printf(" %+6.3f", OutBit[Bit]);
+       printf(" %+6.3f", (double)OutBit[Bit]);
        if((Bit&0xF)==0xF) printf("\n"); }
    }
 
    void addInput(int Bit, Float Ampl)
-   { InpBit[Bit]+=Ampl; OutBit[Bit] = InpBit[Bit]; }
+   { InpBit[Bit]=Arith::Add(InpBit[Bit], Ampl); OutBit[Bit] = InpBit[Bit]; }
 
-   void Input(const uint8_t *Data, const uint8_t *Err, Float Ampl=1.0)   // get bits from series of bytes and the error pattern (from Manchester decoder)
+   void Input(const uint8_t *Data, const uint8_t *Err, Float Ampl=Arith::One())   // get bits from series of bytes and the error pattern (from Manchester decoder)
    { uint8_t Mask=1; int Idx=0; uint8_t DataByte=0; uint8_t ErrByte=0;
      for(int Bit=0; Bit<CodeBits; Bit++)
      { if(Mask==1) { DataByte=Data[Idx];  ErrByte=Err[Idx]; }
        Float Inp;
        if(ErrByte&Mask) Inp=0;
-                   else Inp=(DataByte&Mask) ? +Ampl:-Ampl;
+                   else Inp=(DataByte&Mask) ? Ampl:Arith::Neg(Ampl);
        OutBit[Bit] = InpBit[Bit] = Inp; ExtBit[Bit]=0;
        Mask<<=1; if(Mask==0) { Idx++; Mask=1; }
      }
    }
 
-   void Input(const uint32_t *Data, Float Ampl=1.0)                      // get bits from a series of 32-bit words
+   void Input(const uint32_t *Data, Float Ampl=Arith::One())                      // get bits from a series of 32-bit words
    { uint32_t Mask=0; int Idx=0; uint32_t Word=0;
      for(int Bit=0; Bit<CodeBits; Bit++)
      { if(Mask==0) { Word=Data[Idx++]; Mask=1; }
-       OutBit[Bit] = InpBit[Bit] = (Word&Mask) ? +Ampl:-Ampl; ExtBit[Bit]=0;
+       OutBit[Bit] = InpBit[Bit] = (Word&Mask) ? Ampl:Arith::Neg(Ampl); ExtBit[Bit]=0;
        Mask<<=1;
      }
    }
@@ -302,20 +711,21 @@ template <class Float=float>
      // printf("%d parity checks fail\n", Count);
      if(Count==0) return 0;                                              // if all passed, then return
      for(int Bit=0; Bit<CodeBits; Bit++)                                 // add Input+Extrinsic and store in Output
-     { OutBit[Bit] = InpBit[Bit] + Feedback*ExtBit[Bit]; }
+     { OutBit[Bit] = Arith::Add(InpBit[Bit], Arith::Mul(ExtBit[Bit], Feedback)); }
+     Arith::Rescale(InpBit, OutBit, CodeBits);                           // fixed point: keep away from saturation
      return Count; }
 
    Float ProcessCheck(uint8_t Row)
-   { Float MinAmpl=std::numeric_limits<Float>::max(); int MinBit=0; Float MinAmpl2=MinAmpl;               // look for 1st and 2nd smallest LL
+   { Float MinAmpl=Arith::Max(); int MinBit=0; Float MinAmpl2=MinAmpl;               // look for 1st and 2nd smallest LL
      uint32_t Word=0; uint32_t Mask=1;
-     const uint16_t *CheckIndex = ParityCheckIndex[Row];                 // indeces of bits in this parity check
-     int CheckWeight = ParityCheckRowWeight[Row];                    // number of bits in this parity check
+     const typename Code::Index *CheckIndex = Code::Table.RowIndex[Row]; // number and indeces of bits in this parity check
+     int CheckWeight = *CheckIndex++;                                    // number of bits in this parity check
      for(int Bit=0; Bit<CheckWeight; Bit++)                              // loop over bits in the parity check
      { int BitIdx=CheckIndex[Bit];                                       // index of the bit
        Float Ampl=OutBit[BitIdx];                                       // LL of the bit
        if(Ampl>0) Word|=Mask;                                            // store hard bits in the Word
        Mask<<=1;
-       if(Ampl<0) Ampl=(-Ampl);                                          // strip the LL sign
+       if(Ampl<0) Ampl=Arith::Neg(Ampl);                                 // strip the LL sign
        if(Ampl<MinAmpl) { MinAmpl2=MinAmpl; MinAmpl=Ampl; MinBit=Bit; }  // find 1st and 2nd smallest
        else if(Ampl<MinAmpl2) { MinAmpl2=Ampl; }
      }
@@ -324,10 +734,10 @@ template <class Float=float>
      for(int Bit=0; Bit<CheckWeight; Bit++)                              // loop over bits in this parity check
      { int BitIdx=CheckIndex[Bit];                                       // inndex of the bit
        Float Ampl = Bit==MinBit ? MinAmpl2 : MinAmpl;                   // if this is the weakest bit, then use 2nd smallest LL, otherwise 1st
-       if(CheckFails) Ampl=(-Ampl);
-       ExtBit[BitIdx] += (Word&Mask) ? Ampl:-Ampl;                       // add to the extrinsic inf. with the correct sign
+       if(CheckFails) Ampl=Arith::Neg(Ampl);
+       ExtBit[BitIdx] = Arith::Add(ExtBit[BitIdx], (Word&Mask) ? Ampl:Arith::Neg(Ampl)); // add to the extrinsic inf. with the correct sign
        Mask<<=1; }
-     return CheckFails?-MinAmpl:MinAmpl; }
+     return CheckFails?Arith::Neg(MinAmpl):MinAmpl; }
 
    int CountErrors(void)
    { int Count=0;
@@ -340,9 +750,11 @@ template <class Float=float>
 } ;
 
 #ifdef WITH_PPM
-template <class Float>
+template <class Float>                                    // Float=int16_t for the fixed point decoder
  class OGN_PPM_Decoder
 { public:
+   typedef LDPC_Arith<Float> Arith;
+
    static const int DataBits = 32*5;                      // 5 words = 160 data bits = OGN packet
    static const int ParityBits = 194;                     // 194 parity bits (Gallager code)
    static const int CodeBits = DataBits+ParityBits;       // 354 total bits per Gallager code block
@@ -350,7 +762,7 @@ template <class Float>
    static const int PulsesPerSlot = 1<<BitsPerSymbol;     // 64 (possible) pulses per time slot = 1 symbol = 6 bits
    static const int CodeSymbols = CodeBits/BitsPerSymbol; // 59 time slots to form complete packet
 
-   LDPC_FloatDecoder<Float> LDPC_Decoder;                 // inner LDPC code decoder
+   LDPC_FloatDecoder<Float, LDPC_n354k160> LDPC_Decoder;  // inner LDPC code decoder
 
    Float InpSymb[CodeSymbols][PulsesPerSlot];             // input from the demodulator
    Float ExtSymb[CodeSymbols][PulsesPerSlot];             // output from the LDPC decoder
@@ -358,40 +770,52 @@ template <class Float>
 
   public:
    OGN_PPM_Decoder()
-   { LDPC_Decoder.Configure(CodeBits, ParityBits, (uint32_t *)LDPC_ParityCheck_n354k160);
-     Clear(); }
+   { Clear(); }
 
    void Clear(void)
    { for(int Symb=0; Symb<CodeSymbols; Symb++)
-     { Float Ext=1.0/PulsesPerSlot;
+     { Float Ext=Arith::Uniform(PulsesPerSlot);
        for(int Pulse=0; Pulse<PulsesPerSlot; Pulse++)
        { InpSymb[Symb][Pulse]=0; ExtSymb[Symb][Pulse]=Ext; OutSymb[Symb][Pulse]=0; }
      }
    }
 
-   void addSymbol(unsigned int Slot, unsigned int Symbol, Float Power=1.0)
+   void addSymbol(unsigned int Slot, unsigned int Symbol, Float Power=Arith::One())
    { if( (Slot>=CodeSymbols) || (Symbol>=PulsesPerSlot) ) return;
-     InpSymb[Slot][Symbol]+=Power; }
+     InpSymb[Slot][Symbol]=Arith::Add(InpSymb[Slot][Symbol], Power); }
+
+   void SymbolToBits(int Symb, typename Arith::Acc BitLL[BitsPerSymbol]) const // soft bits out of the pulses of one symbol
+   { for(int Bit=0; Bit<BitsPerSymbol; Bit++) BitLL[Bit]=0;
+     for(int Pulse=0; Pulse<PulsesPerSlot; Pulse++)
+     { typename Arith::Acc Pwr=Arith::Weight(InpSymb[Symb][Pulse], ExtSymb[Symb][Pulse]);
+       if(Pwr==0) continue;
+       Pwr=Arith::Square(Pwr);
+       int Bin=Binary(Pulse);
+       for(int Bit=0; Bit<BitsPerSymbol; Bit++)
+       { if(Bin&1) BitLL[Bit]+=Pwr;
+              else BitLL[Bit]-=Pwr;
+         Bin>>=1; }
+     }
+   }
 
    int Process(int Loops=48)
    { LDPC_Decoder.Clear();
-
-     for(int Symb=0; Symb<CodeSymbols; Symb++)
-     { for(int Pulse=0; Pulse<PulsesPerSlot; Pulse++)
-       { Float Pwr=InpSymb[Symb][Pulse]*ExtSymb[Symb][Pulse];
-         if(Pwr==0) continue;
-         Pwr=Pwr*Pwr;
-         int Bin=Binary(Pulse);
+     typename Arith::Acc Max=0;
+     for(int Pass=Arith::Scaled?0:1; Pass<2; Pass++)           // fixed point: 1st pass finds the largest bit LL to scale the input
+     { int Shift = Pass ? Arith::Headroom(Max) : 0;
+       for(int Symb=0; Symb<CodeSymbols; Symb++)
+       { typename Arith::Acc BitLL[BitsPerSymbol];
+         SymbolToBits(Symb, BitLL);
          int Idx=Symb;
          for(int Bit=0; Bit<BitsPerSymbol; Bit++, Idx+=CodeSymbols)
-         { LDPC_Decoder.addInput(Idx, (Bin&1) ? +Pwr:-Pwr);
-           Bin>>=1; }
+         { if(Pass) { LDPC_Decoder.addInput(Idx, Arith::Reduce(BitLL[Bit], Shift)); continue; }
+           typename Arith::Acc Ampl = BitLL[Bit]<0 ? -BitLL[Bit]:BitLL[Bit];
+           if(Ampl>Max) Max=Ampl; }
        }
      }
      int CheckErr=0;
      for( int Loop=0; Loop<Loops; Loop++)
      { CheckErr=LDPC_Decoder.ProcessChecks();
-       printf("%3d: OGN_PPM_Decoder.Process() => %3d\n", Loop, CheckErr);
        if(CheckErr==0) break; }
      return CheckErr; }
 
@@ -403,19 +827,13 @@ template <class Float>
      Gray = Gray ^ (Gray >> 1);
      return Gray; }
 
-   void NormExtSymb(Float Norm=1.0)
+   void NormExtSymb(Float Norm=Arith::One())
    { for(int Symb=0; Symb<CodeSymbols; Symb++)
      { NormExtSymb(Symb, Norm); }
    }
 
-   void NormExtSymp(int Symb, Float Norm=1.0)
-   { Float Sum=0;
-     for(int Pulse=0; Pulse<PulsesPerSlot; Pulse++)
-     { Sum+=ExtSymb[Symb][Pulse]; }
-     Sum=Norm/Sum;
-     for(int Pulse=0; Pulse<PulsesPerSlot; Pulse++)
-     { ExtSymb[Symb][Pulse]*=Sum; }    
-   }
+   void NormExtSymb(int Symb, Float Norm=Arith::One())
+   { Arith::Normalize(ExtSymb[Symb], PulsesPerSlot, Norm); }
 
 } ;
 #endif // WITH_PPM
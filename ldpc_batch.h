@@ -0,0 +1,206 @@
+#ifndef __LDPC_BATCH_H__
+#define __LDPC_BATCH_H__
+
+// Batch LDPC decoder for the host (ground receivers): decodes 8/16/32 n208k160 packets at once.
+// The soft bits are stored structure-of-arrays: [CodeBit][Lane] so the min-sum check update
+// runs across all lanes with SSE2 or AVX2 - or with plain C when neither is available.
+// Every lane gives bit-exact the same result as LDPC_Decoder (LDPC_CodeDecoder<>) from ldpc.h
+
+#include <stdint.h>
+
+#include "ldpc.h"
+
+#if defined(__SSE2__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+class LDPC_VecPlain                                  // portable fallback: 8 lanes of int16_t
+{ public:
+   static const int Width=8;
+   struct T { int16_t Lane[Width]; } ;
+
+   static T Load(const int16_t *Ptr)    { T R; for(int Idx=0; Idx<Width; Idx++) R.Lane[Idx]=Ptr[Idx]; return R; }
+   static void Store(int16_t *Ptr, T A) { for(int Idx=0; Idx<Width; Idx++) Ptr[Idx]=A.Lane[Idx]; }
+   static T Set1(int16_t Val)           { T R; for(int Idx=0; Idx<Width; Idx++) R.Lane[Idx]=Val; return R; }
+   static T Zero(void)                  { return Set1(0); }
+   static T Add(T A, T B) { T R; for(int Idx=0; Idx<Width; Idx++) R.Lane[Idx]=(int16_t)(A.Lane[Idx]+B.Lane[Idx]); return R; }
+   static T Sub(T A, T B) { T R; for(int Idx=0; Idx<Width; Idx++) R.Lane[Idx]=(int16_t)(A.Lane[Idx]-B.Lane[Idx]); return R; }
+   static T AddSat(T A, T B) { T R; for(int Idx=0; Idx<Width; Idx++) R.Lane[Idx]=LDPC_Sat16(A.Lane[Idx]+B.Lane[Idx]); return R; }
+   static T SubSat(T A, T B) { T R; for(int Idx=0; Idx<Width; Idx++) R.Lane[Idx]=LDPC_Sat16(A.Lane[Idx]-B.Lane[Idx]); return R; }
+   static T Min(T A, T B) { T R; for(int Idx=0; Idx<Width; Idx++) R.Lane[Idx]=A.Lane[Idx]<B.Lane[Idx]?A.Lane[Idx]:B.Lane[Idx]; return R; }
+   static T Max(T A, T B) { T R; for(int Idx=0; Idx<Width; Idx++) R.Lane[Idx]=A.Lane[Idx]>B.Lane[Idx]?A.Lane[Idx]:B.Lane[Idx]; return R; }
+   static T Xor(T A, T B) { T R; for(int Idx=0; Idx<Width; Idx++) R.Lane[Idx]=A.Lane[Idx]^B.Lane[Idx]; return R; }
+   static T Or (T A, T B) { T R; for(int Idx=0; Idx<Width; Idx++) R.Lane[Idx]=A.Lane[Idx]|B.Lane[Idx]; return R; }
+   static T CmpGt(T A, T B) { T R; for(int Idx=0; Idx<Width; Idx++) R.Lane[Idx]=A.Lane[Idx]>B.Lane[Idx]?-1:0; return R; }
+   static T CmpEq(T A, T B) { T R; for(int Idx=0; Idx<Width; Idx++) R.Lane[Idx]=A.Lane[Idx]==B.Lane[Idx]?-1:0; return R; }
+   static T Select(T Mask, T A, T B) { T R; for(int Idx=0; Idx<Width; Idx++) R.Lane[Idx]=(Mask.Lane[Idx]&A.Lane[Idx])|(~Mask.Lane[Idx]&B.Lane[Idx]); return R; }
+   static T Sra1(T A)     { T R; for(int Idx=0; Idx<Width; Idx++) R.Lane[Idx]=A.Lane[Idx]>>1; return R; }
+} ;
+
+#ifdef __SSE2__
+class LDPC_VecSSE2                                   // SSE2: 8 lanes of int16_t
+{ public:
+   static const int Width=8;
+   typedef __m128i T;
+
+   static T Load(const int16_t *Ptr)    { return _mm_load_si128((const __m128i *)Ptr); }
+   static void Store(int16_t *Ptr, T A) { _mm_store_si128((__m128i *)Ptr, A); }
+   static T Set1(int16_t Val)           { return _mm_set1_epi16(Val); }
+   static T Zero(void)                  { return _mm_setzero_si128(); }
+   static T Add(T A, T B)   { return _mm_add_epi16(A, B); }
+   static T Sub(T A, T B)   { return _mm_sub_epi16(A, B); }
+   static T AddSat(T A, T B) { return _mm_adds_epi16(A, B); }
+   static T SubSat(T A, T B) { return _mm_subs_epi16(A, B); }
+   static T Min(T A, T B)   { return _mm_min_epi16(A, B); }
+   static T Max(T A, T B)   { return _mm_max_epi16(A, B); }
+   static T Xor(T A, T B)   { return _mm_xor_si128(A, B); }
+   static T Or (T A, T B)   { return _mm_or_si128(A, B); }
+   static T CmpGt(T A, T B) { return _mm_cmpgt_epi16(A, B); }
+   static T CmpEq(T A, T B) { return _mm_cmpeq_epi16(A, B); }
+   static T Select(T Mask, T A, T B) { return _mm_or_si128(_mm_and_si128(Mask, A), _mm_andnot_si128(Mask, B)); }
+   static T Sra1(T A)       { return _mm_srai_epi16(A, 1); }
+} ;
+#endif // __SSE2__
+
+#ifdef __AVX2__
+class LDPC_VecAVX2                                   // AVX2: 16 lanes of int16_t
+{ public:
+   static const int Width=16;
+   typedef __m256i T;
+
+   static T Load(const int16_t *Ptr)    { return _mm256_load_si256((const __m256i *)Ptr); }
+   static void Store(int16_t *Ptr, T A) { _mm256_store_si256((__m256i *)Ptr, A); }
+   static T Set1(int16_t Val)           { return _mm256_set1_epi16(Val); }
+   static T Zero(void)                  { return _mm256_setzero_si256(); }
+   static T Add(T A, T B)   { return _mm256_add_epi16(A, B); }
+   static T Sub(T A, T B)   { return _mm256_sub_epi16(A, B); }
+   static T AddSat(T A, T B) { return _mm256_adds_epi16(A, B); }
+   static T SubSat(T A, T B) { return _mm256_subs_epi16(A, B); }
+   static T Min(T A, T B)   { return _mm256_min_epi16(A, B); }
+   static T Max(T A, T B)   { return _mm256_max_epi16(A, B); }
+   static T Xor(T A, T B)   { return _mm256_xor_si256(A, B); }
+   static T Or (T A, T B)   { return _mm256_or_si256(A, B); }
+   static T CmpGt(T A, T B) { return _mm256_cmpgt_epi16(A, B); }
+   static T CmpEq(T A, T B) { return _mm256_cmpeq_epi16(A, B); }
+   static T Select(T Mask, T A, T B) { return _mm256_blendv_epi8(B, A, Mask); }
+   static T Sra1(T A)       { return _mm256_srai_epi16(A, 1); }
+} ;
+#endif // __AVX2__
+
+template <int Lanes, bool Wide=(Lanes%16==0)>        // pick the widest vector which divides the number of lanes
+ struct LDPC_BatchVec
+{
+#ifdef __SSE2__
+  typedef LDPC_VecSSE2 Vec;
+#else
+  typedef LDPC_VecPlain Vec;
+#endif
+} ;
+
+#ifdef __AVX2__
+template <int Lanes>
+ struct LDPC_BatchVec<Lanes, true>
+{ typedef LDPC_VecAVX2 Vec; } ;
+#endif
+
+template <int Lanes=16, class Def=LDPC_n208k160>
+ class LDPC_BatchDecoder
+{ public:
+   typedef LDPC_CodeDecoder<Def> Decoder;
+   const static uint8_t CodeBits   = Decoder::CodeBits;        // 208 code bits
+   const static uint8_t CodeBytes  = Decoder::CodeBytes;       //  26 bytes
+   const static uint8_t ParityBits = Decoder::ParityBits;      //  48 parity checks
+
+   typedef typename LDPC_BatchVec<Lanes>::Vec Vec;
+   typedef typename Vec::T VecT;
+
+   static_assert(Lanes%8==0, "LDPC_BatchDecoder: number of lanes must be a multiple of 8");
+
+  public:
+
+   alignas(32) int16_t InpBit[CodeBits][Lanes]; // a-priori bits
+   alignas(32) int16_t ExtBit[CodeBits][Lanes]; // extrinsic inf.
+   alignas(32) int16_t OutBit[CodeBits][Lanes]; // a-posteriori bits
+   alignas(32) int16_t Count[Lanes];            // number of failed parity checks per lane, from the last ProcessChecks()
+
+   void Input(int Lane, const uint8_t *Data, const uint8_t *Err) // same as LDPC_Decoder::Input() but into the given lane
+   { uint8_t Mask=1; uint8_t Idx=0; uint8_t DataByte=0; uint8_t ErrByte=0;
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { if(Mask==1) { DataByte=Data[Idx];  ErrByte=Err[Idx]; }
+       int16_t Inp;
+       if(ErrByte&Mask) Inp=0;
+                   else Inp=(DataByte&Mask) ? +128:-128;
+       OutBit[Bit][Lane] = InpBit[Bit][Lane] = Inp; ExtBit[Bit][Lane]=0;
+       Mask<<=1; if(Mask==0) { Idx++; Mask=1; }
+     }
+     Count[Lane]=0; }
+
+   void Input(int Lane, const Decoder &Single)                  // copy the soft bits already loaded into a single-packet decoder
+   { for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { InpBit[Bit][Lane] = Single.InpBit[Bit];
+       OutBit[Bit][Lane] = Single.OutBit[Bit];
+       ExtBit[Bit][Lane] = 0; }
+     Count[Lane]=0; }
+
+   void Idle(int Lane)                                          // fill an unused lane with the all-zero codeword: it passes all checks at once
+   { for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { OutBit[Bit][Lane] = InpBit[Bit][Lane] = -128; ExtBit[Bit][Lane]=0; }
+     Count[Lane]=0; }
+
+   void Output(int Lane, uint8_t Data[CodeBytes]) const
+   { uint8_t Mask=1; uint8_t Idx=0; uint8_t Byte=0;
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { if(OutBit[Bit][Lane]>0) Byte|=Mask;
+       Mask<<=1; if(Mask==0) { Data[Idx++]=Byte; Byte=0; Mask=1; }
+     } if(Mask>1) Data[Idx++]=Byte;
+   }
+
+   int ProcessChecks(void)                                      // one min-sum iteration on all lanes, return the number of lanes which still fail
+   { VecT Zero = Vec::Zero();
+     VecT One  = Vec::Set1(1);
+     VecT Ones = Vec::Set1(-1);
+     int Fail=0;
+     for(int Ofs=0; Ofs<Lanes; Ofs+=Vec::Width)
+     { for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+         Vec::Store(ExtBit[Bit]+Ofs, Zero);
+       VecT FailCount = Zero;
+       for(uint8_t Row=0; Row<ParityBits; Row++)
+       { const uint8_t *CheckIndex = Decoder::Code::Table.RowIndex[Row];
+         uint8_t CheckWeight = *CheckIndex++;
+         VecT MinAmpl = Vec::Set1(32767); VecT MinAmpl2 = MinAmpl; VecT MinBit = Zero; VecT Parity = Zero;
+         for(uint8_t Bit=0; Bit<CheckWeight; Bit++)
+         { VecT Inp  = Vec::Load(OutBit[CheckIndex[Bit]]+Ofs);
+           Parity    = Vec::Xor(Parity, Vec::CmpGt(Inp, Zero));
+           VecT Ampl = Vec::Max(Inp, Vec::SubSat(Zero, Inp));   // |-32768| = 32767 like LDPC_Abs15()
+           VecT Less = Vec::CmpGt(MinAmpl, Ampl);
+           MinAmpl2  = Vec::Select(Less, MinAmpl, Vec::Min(MinAmpl2, Ampl));
+           MinAmpl   = Vec::Min(MinAmpl, Ampl);
+           MinBit    = Vec::Select(Less, Vec::Set1(Bit), MinBit); }
+         FailCount = Vec::Sub(FailCount, Vec::Or(Parity, Vec::CmpGt(One, MinAmpl))); // count when the check fails or MinAmpl<=0
+         for(uint8_t Bit=0; Bit<CheckWeight; Bit++)
+         { int16_t *Ext = ExtBit[CheckIndex[Bit]]+Ofs;
+           VecT Inp  = Vec::Load(OutBit[CheckIndex[Bit]]+Ofs);
+           VecT Neg  = Vec::Xor(Vec::Xor(Vec::CmpGt(Inp, Zero), Parity), Ones); // negate unless (bit>0) XOR (check fails)
+           VecT Ampl = Vec::Select(Vec::CmpEq(MinBit, Vec::Set1(Bit)), MinAmpl2, MinAmpl);
+           Ampl      = Vec::Sub(Vec::Xor(Ampl, Neg), Neg);
+           Vec::Store(Ext, Vec::AddSat(Vec::Load(Ext), Ampl)); }
+       }
+       Vec::Store(Count+Ofs, FailCount);
+       VecT Pass = Vec::CmpEq(FailCount, Zero);                 // lanes which pass all checks keep their OutBit
+       for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+       { VecT Out = Vec::AddSat(Vec::Load(InpBit[Bit]+Ofs), Vec::Sra1(Vec::Load(ExtBit[Bit]+Ofs)));
+         Vec::Store(OutBit[Bit]+Ofs, Vec::Select(Pass, Vec::Load(OutBit[Bit]+Ofs), Out)); }
+     }
+     for(int Lane=0; Lane<Lanes; Lane++)
+       if(Count[Lane]) Fail++;
+     return Fail; }
+
+   int Decode(uint8_t Iter=32)                                  // iterate until all lanes pass or Iter runs out, return the number of failed lanes
+   { int Fail=0;
+     for( ; Iter; Iter--)
+     { Fail=ProcessChecks(); if(Fail==0) break; }
+     return Fail; }                                             // lanes which passed do not change anymore thus the result per lane equals LDPC_Decoder
+
+} ;
+
+#endif // __LDPC_BATCH_H__
@@ -0,0 +1,165 @@
+// g++ -std=gnu++14 -O2 -I. -DWITH_LDPC_LAYERED -DWITH_LDPC_CHASE -o ldpc_bench ldpc_bench.cc ldpc.cpp bitcount.cpp
+// ./ldpc_bench [packets per point] [seed] > ldpc_bench.csv
+
+// Benchmark of the LDPC decoders over the channel models of ldpc_channel.h:
+// frame error rate, bit error rate, average iterations and decoding speed as a function of Eb/N0.
+// The output is CSV, one line per decoder, channel and Eb/N0, so speed and sensitivity can be compared together.
+// recovered_per_us tells how many more packets a decoder recovers than LDPC_Decoder per microsecond of extra CPU time.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "ldpc.h"
+#include "ldpc_channel.h"
+
+const int CodeBytes = LDPC_Decoder::CodeBytes;
+const int UserBytes = LDPC_Decoder::UserBits/8;
+const int MaxIter   = 32;                           // as RFM_RxPktData::Decode() has it
+#ifdef WITH_LDPC_CHASE
+const int RFM_ChaseBits = 8;                        // as RFM_RxPktData::ChaseBits
+const int ChaseTests    = 256;                      // Chase stage CPU budget, as RFM_RxPktData::Decode() has it
+#endif
+
+static double CPU_Time(void) { return (double)clock()/CLOCKS_PER_SEC; }
+
+static int Dist(const uint8_t *A, const uint8_t *B, int Bytes)
+{ int Count=0;
+  for(int Idx=0; Idx<Bytes; Idx++) Count+=Count1s((uint8_t)(A[Idx]^B[Idx]));
+  return Count; }
+
+struct Packet
+{ uint8_t Code[CodeBytes];                          // transmitted
+  uint8_t Data[CodeBytes];                          // received hard bits
+  uint8_t Err [CodeBytes];                          // Manchester errors
+  float   Soft[8*CodeBytes];                        // soft values, bit order as in LDPC_Decoder::Input(Data, Err)
+} ;
+
+struct Result
+{ int Packets, FrameErr, BitErr, Iter; double Time;
+  void Clear(void) { Packets=FrameErr=BitErr=Iter=0; Time=0; }
+  void Add(const uint8_t *Out, const uint8_t *Code, int Iterations)
+  { int Bits=Dist(Out, Code, UserBytes);
+    Packets++; BitErr+=Bits; if(Bits) FrameErr++; Iter+=Iterations; }
+} ;
+
+enum { Flooding=0, Flooding2x, Chase, Layered, Compact, FloatHard, FloatSoft, Decoders };
+
+static const char *DecoderName[Decoders] = { "LDPC_Decoder", "LDPC_Decoder/2xiter", "LDPC_Decoder/chase",
+                                             "LDPC_Decoder/layered", "LDPC_Decoder8", "LDPC_FloatDecoder/hard", "LDPC_FloatDecoder/soft" };
+
+static int Decode(int Type, uint8_t *Out, const Packet &Pkt, float Sigma)    // returns the number of iterations used
+{ static LDPC_Decoder Decoder;
+  static LDPC_Decoder8 Decoder8;
+  static LDPC_FloatDecoder<float> Float;
+  int Iter=0;
+  if(Type==Flooding || Type==Flooding2x)
+  { int Max = Type==Flooding2x ? 2*MaxIter:MaxIter;                  // twice the iterations: to compare with the Chase stage
+    Decoder.Input(Pkt.Data, Pkt.Err);
+    for(Iter=1; Iter<=Max; Iter++)
+      if(Decoder.ProcessChecks()==0) break;
+    Decoder.Output(Out);
+    if(Iter>Max) Iter=Max;
+    return Iter; }
+#ifdef WITH_LDPC_CHASE
+  else if(Type==Chase)
+  { Decoder.Input(Pkt.Data, Pkt.Err);
+    for(Iter=1; Iter<=MaxIter; Iter++)
+      if(Decoder.ProcessChecks()==0) break;
+    if(Iter>MaxIter) Decoder.ChaseCorrect(Pkt.Err, RFM_ChaseBits, ChaseTests);
+    Decoder.Output(Out); }
+#endif
+#ifdef WITH_LDPC_LAYERED
+  else if(Type==Layered)
+  { Decoder.Input(Pkt.Data, Pkt.Err);
+    for(Iter=1; Iter<=MaxIter/2; Iter++)
+      if(Decoder.ProcessChecksLayered()==0) break;
+    Decoder.Output(Out);
+    if(Iter>MaxIter/2) Iter=MaxIter/2; }
+#endif
+  else if(Type==Compact)                                             // int8 layered: half the iterations as well
+  { Decoder8.Input(Pkt.Data, Pkt.Err);
+    for(Iter=1; Iter<=MaxIter/2; Iter++)
+      if(Decoder8.ProcessChecks()==0) break;
+    Decoder8.Output(Out);
+    if(Iter>MaxIter/2) Iter=MaxIter/2; }
+  else
+  { if(Type==FloatHard) Float.Input(Pkt.Data, Pkt.Err);
+    else
+    { Float.Clear();
+      float Scale = 4/(Sigma*Sigma);                                 // LLR of the chip difference
+      for(int Bit=0; Bit<LDPC_Decoder::CodeBits; Bit++)
+        Float.addInput(Bit, Scale*Pkt.Soft[Bit]); }
+    for(Iter=1; Iter<=MaxIter; Iter++)
+      if(Float.ProcessChecks()==0) break;
+    Float.Output(Out); }
+  if(Iter>MaxIter) Iter=MaxIter;                                     // Iter counts the last iteration when not converged
+  return Iter; }
+
+static void BenchEncode(int Packets)                 // encoder and parity check speed
+{ static uint8_t Code[1024][CodeBytes];
+  for(int Pkt=0; Pkt<1024; Pkt++)
+    for(int Idx=0; Idx<UserBytes; Idx++) Code[Pkt][Idx]=rand();
+  int Loops = (Packets+1023)/1024; if(Loops<64) Loops=64;
+  double Start=CPU_Time();
+  for(int Loop=0; Loop<Loops; Loop++)
+    for(int Pkt=0; Pkt<1024; Pkt++) LDPC_Encode(Code[Pkt]);
+  double Time=CPU_Time()-Start;
+  printf("LDPC_Encode,none,,%d,0,0,0,%.0f,\n", Loops*1024, Loops*1024/Time);
+  int Fail=0;
+  Start=CPU_Time();
+  for(int Loop=0; Loop<Loops; Loop++)
+    for(int Pkt=0; Pkt<1024; Pkt++) Fail+=LDPC_Check(Code[Pkt])!=0;
+  Time=CPU_Time()-Start;
+  printf("LDPC_Check,none,,%d,%.6f,0,0,%.0f,\n", Loops*1024, (double)Fail/(Loops*1024), Loops*1024/Time);
+}
+
+int main(int argc, char *argv[])
+{ int Packets = argc>1 ? atoi(argv[1]):1000;
+  srand(argc>2 ? atoi(argv[2]):1);
+  const float Rate = (float)LDPC_Decoder::UserBits/LDPC_Decoder::CodeBits;
+  Packet *Pkt = new Packet[Packets];
+  uint8_t (*Out)[CodeBytes] = new uint8_t[Packets][CodeBytes];       // decoded packets and the iterations they took
+  int *Iter = new int[Packets];
+  printf("decoder,channel,ebn0_db,packets,fer,ber,avg_iter,pkt_per_sec,recovered_per_us\n");
+  BenchEncode(Packets);
+  for(int Model=LDPC_Channel::AWGN; Model<=LDPC_Channel::Erasure; Model++)
+  { LDPC_Channel Channel(Model);
+    for(float EbN0=0.0; EbN0<=10.01; EbN0+=1.0)
+    { Channel.setEbN0(EbN0, Rate);
+      for(int Idx=0; Idx<Packets; Idx++)                              // the same packets are given to every decoder
+      { for(int Byte=0; Byte<UserBytes; Byte++) Pkt[Idx].Code[Byte]=rand();
+        LDPC_Encode(Pkt[Idx].Code);
+        Channel.Transmit(Pkt[Idx].Data, Pkt[Idx].Err, Pkt[Idx].Soft, Pkt[Idx].Code, CodeBytes); }
+      Result Ref; Ref.Clear();
+      for(int Type=0; Type<Decoders; Type++)
+      {
+#ifndef WITH_LDPC_LAYERED
+        if(Type==Layered) continue;
+#endif
+#ifndef WITH_LDPC_CHASE
+        if(Type==Chase) continue;
+#endif
+        Result Res; Res.Clear();
+        double Start=CPU_Time();                                      // time the whole batch: the clock is too coarse for a single packet
+        for(int Idx=0; Idx<Packets; Idx++)
+          Iter[Idx]=Decode(Type, Out[Idx], Pkt[Idx], Channel.Sigma);
+        Res.Time=CPU_Time()-Start;
+        for(int Idx=0; Idx<Packets; Idx++)
+          Res.Add(Out[Idx], Pkt[Idx].Code, Iter[Idx]);
+        if(Type==Flooding) Ref=Res;
+        double ExtraTime = 1e6*(Res.Time-Ref.Time);                   // [us] extra CPU time compared to LDPC_Decoder
+        printf("%s,%s,%.1f,%d,%.6f,%.3e,%.2f,%.0f,", DecoderName[Type], Channel.Name(), EbN0, Res.Packets,
+               (double)Res.FrameErr/Res.Packets, (double)Res.BitErr/(Res.Packets*LDPC_Decoder::UserBits),
+               (double)Res.Iter/Res.Packets, Res.Time>0 ? Res.Packets/Res.Time:0.0);
+        if(Type!=Flooding && ExtraTime>0) printf("%.4f", (Ref.FrameErr-Res.FrameErr)/ExtraTime);
+        printf("\n");
+        fflush(stdout); }
+    }
+  }
+  delete [] Iter;
+  delete [] Out;
+  delete [] Pkt;
+  return 0; }
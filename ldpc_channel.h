@@ -0,0 +1,90 @@
+#ifndef __LDPC_CHANNEL_H__
+#define __LDPC_CHANNEL_H__
+
+// Channel models for host tests and benchmarks of the LDPC decoders.
+// The packet is sent Manchester encoded: two antipodal chips per code bit, chip amplitude is 1.
+// The receiver side is modelled after RFM_TRX::ReadPacket(): hard chip decisions are packed into bytes
+// and put through ManchesterDecode[] which gives the data bits and the Err[] flags for chip pairs which are not 01 or 10.
+// Next to the Data[]/Err[] bytes a soft value per code bit (difference of the two chips) is given,
+// which is what an ideal soft demodulator would deliver.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "manchester.h"
+
+class LDPC_Channel
+{ public:
+   static const int MaxBytes = 64;
+
+   enum { AWGN=0, Burst=1, Erasure=2 };
+   int   Model;                                    // AWGN, AWGN+Burst or AWGN+Erasure
+   float Sigma;                                    // noise RMS per chip
+   int   BurstLen;                                 // [chips] length of the burst where chips are random
+   float EraseProb;                                // probability that a chip pair is hit by an interference (both chips same)
+
+  public:
+   LDPC_Channel(int Model=AWGN) : Model(Model), Sigma(0), BurstLen(24), EraseProb(0.02) { }
+
+   static const char *Name(int Model)
+   { static const char *Table[3] = { "awgn", "burst", "erasure" };
+     return Table[Model]; }
+
+   const char *Name(void) const { return Name(Model); }
+
+   static double Uniform(void) { return (rand()+1.0)/(RAND_MAX+2.0); }   // 0 < Uniform() < 1
+
+   static double Gauss(void)                        // normal distribution by Box-Muller
+   { double U1 = Uniform();
+     double U2 = Uniform();
+     return sqrt(-2*log(U1))*cos(2*M_PI*U2); }
+
+   void setEbN0(float EbN0_dB, float Rate)         // Rate = UserBits/CodeBits, two chips carry energy of one code bit
+   { float EbN0 = pow(10.0, EbN0_dB/10);
+     Sigma = sqrt(1.0/(Rate*EbN0)); }
+
+   // Code[] = transmitted packet, bit #0 is the LSB of Code[0], as LDPC_Encode() and LDPC_Decoder::Input() have it
+   // Data[], Err[] = received bytes and error flags like RFM_TRX::ReadPacket() gives them
+   // Soft[] = (optional) soft value per code bit, positive for "1", in units of the chip amplitude
+   void Transmit(uint8_t *Data, uint8_t *Err, float *Soft, const uint8_t *Code, int Bytes) const
+   { float Chip[2*8*MaxBytes];
+     int Chips=0;
+     for(int Idx=0; Idx<Bytes; Idx++)                                   // Manchester encode: MSB is sent first
+     { for(int Nibble=1; Nibble>=0; Nibble--)
+       { uint8_t Manch = ManchesterEncode[(Code[Idx]>>(4*Nibble))&0x0F];
+         for(uint8_t Mask=0x80; Mask; Mask>>=1)
+           Chip[Chips++] = (Manch&Mask) ? +1.0:-1.0; }
+     }
+     for(int Idx=0; Idx<Chips; Idx++)                                   // add white noise
+       Chip[Idx] += Sigma*Gauss();
+     if(Model==Burst)                                                   // a burst of strong interference: random chips
+     { int Start = rand()%(Chips-BurstLen+1);
+       for(int Idx=Start; Idx<Start+BurstLen; Idx++)
+         Chip[Idx] = 4*Gauss(); }
+     else if(Model==Erasure)                                            // interference pulses which make both chips equal
+     { for(int Idx=0; Idx<Chips; Idx+=2)
+       { if(Uniform()>=EraseProb) continue;
+         float Level = (rand()&1) ? +2.0:-2.0;
+         Chip[Idx]=Chip[Idx+1]=Level; }
+     }
+     int ChipIdx=0;
+     for(int Idx=0; Idx<Bytes; Idx++)                                   // hard chip decisions and ManchesterDecode[] like RFM_TRX::ReadPacket()
+     { uint8_t Byte=0; uint8_t ByteErr=0;
+       for(int Nibble=1; Nibble>=0; Nibble--)
+       { uint8_t Manch=0;
+         for(int Bit=0; Bit<8; Bit++)
+           Manch = (Manch<<1) | (Chip[ChipIdx+Bit]>0);
+         Manch = ManchesterDecode[Manch];
+         Byte    = (Byte   <<4) | (Manch&0x0F);
+         ByteErr = (ByteErr<<4) | (Manch>>4);
+         if(Soft)
+         { for(int Bit=0; Bit<4; Bit++)                                 // "1" is sent as chips 01
+             Soft[Idx*8+4*Nibble+3-Bit] = (Chip[ChipIdx+2*Bit+1]-Chip[ChipIdx+2*Bit])/2; }
+         ChipIdx+=8; }
+       Data[Idx]=Byte; Err[Idx]=ByteErr; }
+   }
+
+} ;
+
+#endif // __LDPC_CHANNEL_H__
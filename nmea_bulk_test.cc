@@ -0,0 +1,189 @@
+// g++ -std=gnu++14 -O2 -I. -o nmea_bulk_test nmea_bulk_test.cc format.cpp nmea.cpp intmath.cpp ldpc.cpp bitcount.cpp
+
+// NMEA_BulkReader against the per-line readers: a log of $POGNT, GPS and other lines, with corrupted lines among them,
+// is written to a file, mapped and parsed into the columns. Every line is then given to OGN_RxPacket::ReadPOGNT()
+// and to one GPS_Position::ReadNMEA() in turn: the accepted lines and every value read must be the same.
+// Prints the throughput of both.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <chrono>
+
+#include "ogn.h"
+#include "nmea_bulk.h"
+
+static double Wall_Time(void)
+{ return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count(); }
+
+static int Sentence(char *Line, const char *Body)              // $Body*CS\r\n
+{ uint8_t Check=0; int Len=0;
+  Line[Len++]='$';
+  for( ; Body[Len-1]; Len++) { Line[Len]=Body[Len-1]; Check^=Body[Len-1]; }
+  Len+=sprintf(Line+Len, "*%02X\r\n", Check);
+  return Len; }
+
+static int RandomPOGNT(char *Line)
+{ OGN_RxPacket Packet; Packet.Clear();
+  Packet.Packet.HeaderWord=0;
+  Packet.Packet.Header.Address  = rand()&0xFFFFFF;
+  Packet.Packet.Header.AddrType = rand()%4;
+  Packet.Packet.Header.RelayCount = rand()%2;
+  Packet.Packet.Position.AcftType = rand()%16;
+  Packet.Packet.Position.Time = rand()%60;
+  Packet.Packet.Position.FixQuality = rand()%3;
+  Packet.Packet.Position.FixMode = rand()%2;
+  Packet.Packet.EncodeLatitude( rand()%(90*600000) * (rand()&1 ? 1:-1));
+  Packet.Packet.EncodeLongitude(rand()%(180*600000) * (rand()&1 ? 1:-1));
+  Packet.Packet.EncodeAltitude(rand()%5000);
+  if(rand()&1) Packet.Packet.setBaroAltDiff(rand()%600-300); else Packet.Packet.clrBaro();
+  Packet.Packet.EncodeSpeed(rand()%1000);
+  Packet.Packet.EncodeHeading(rand()%3600);
+  Packet.Packet.EncodeClimbRate(rand()%200-100);
+  Packet.Packet.EncodeTurnRate(rand()%200-100);
+  Packet.Packet.EncodeDOP(rand()%60);
+  Packet.RxRSSI = rand()%256;
+  Packet.RxErr  = rand()%16;
+  return Packet.WritePOGNT(Line); }
+
+static int RandomGPS(char *Line)
+{ char Body[128]; int Len=0;
+  int Type=rand()%3;
+  const char *Talker = rand()&1 ? "GP":"GN";
+  bool Fix = rand()%8;
+  if(Type<2)
+  { int Hour=rand()%24, Min=rand()%60, Sec=rand()%60;
+    Len+=sprintf(Body+Len, "%s%s,%02d%02d%02d", Talker, Type==0?"GGA":"RMC", Hour, Min, Sec);
+    if(rand()%4) Len+=sprintf(Body+Len, ".%02d", rand()%100);
+    if(Type==1) Len+=sprintf(Body+Len, ",%c", Fix?'A':'V');
+    if(Fix) Len+=sprintf(Body+Len, ",%02d%02d.%04d,%c,%03d%02d.%04d,%c", rand()%90, rand()%60, rand()%10000, rand()&1?'N':'S',
+                                                                          rand()%180, rand()%60, rand()%10000, rand()&1?'E':'W');
+       else Len+=sprintf(Body+Len, ",,,,");
+    if(Type==0)
+    { Len+=sprintf(Body+Len, ",%d,%02d,%d.%d", Fix?1+rand()%2:0, rand()%(rand()&1?13:100), rand()%20, rand()%10);
+      if(Fix) Len+=sprintf(Body+Len, ",%d.%d,M,%d.%d,M,,", rand()%3000-100, rand()%10, rand()%50, rand()%10);
+         else Len+=sprintf(Body+Len, ",,M,,M,,"); }
+    else
+    { Len+=sprintf(Body+Len, ",%d.%02d,%d.%d", rand()%100, rand()%100, rand()%360, rand()%100);
+      if(rand()%8) Len+=sprintf(Body+Len, ",%02d%02d%02d", 1+rand()%31, 1+rand()%12, rand()%100);
+              else Len+=sprintf(Body+Len, ",");
+      Len+=sprintf(Body+Len, ",,,A"); }
+  }
+  else
+  { Len+=sprintf(Body+Len, "%sGSA,A,%d", Talker, 1+rand()%3);
+    for(int Sat=0; Sat<12; Sat++) { if(rand()&1) Len+=sprintf(Body+Len, ",%02d", 1+rand()%32); else Body[Len++]=','; }
+    Len+=sprintf(Body+Len, ",%d.%02d,%d.%d,%d.%d", rand()%30, rand()%100, rand()%30, rand()%10, rand()%30, rand()%10); }
+  Body[Len]=0;
+  return Sentence(Line, Body); }
+
+static size_t GetLine(char *Line, int &Len, const LogFile_Map &Log, size_t Ptr) // next line, byte by byte as log_read.cpp
+{ Len=0;
+  for( ; Ptr<Log.Size; )
+  { char Byte=Log.Data[Ptr++]; if(Byte=='\n') break;
+    if(Len<255) Line[Len++]=Byte; }
+  Line[Len]=0; return Ptr; }
+
+static const char *Other[] =
+{ "$POGNR,0,0,,-110.0,0,0,,*5B\r\n",
+  "$POGNB,12.3,-0.5,98765,,*1C\r\n",
+  "$GPGSV,3,1,11,03,03,111,00,04,15,270,00,06,01,010,00,13,06,292,00*74\r\n",
+  "TaskPROC: 0x12345678 reset\n",
+  "\n" } ;
+
+static void Mutate(char *Line, int Len)                        // one or two characters changed
+{ static const char Chars[] = "0123456789,.*+-NSEWM $A\t";
+  int Changes=1+rand()%2;
+  for(int Change=0; Change<Changes; Change++)
+  { int Pos=rand()%(Len-2);
+    Line[Pos] = rand()%4 ? Chars[rand()%(sizeof(Chars)-1)] : (char)(0x80+rand()%128); }
+  if(rand()&1)                                                  // with a correct checksum: the fields are then read
+  { const char *Star=(const char *)memchr(Line, '*', Len);
+    if(Star && Line[0]=='$' && Star+2<Line+Len)
+    { uint8_t Check=0; for(const char *Ptr=Line+1; Ptr<Star; Ptr++) Check^=*Ptr;
+      char *Sum=(char *)Star+1; Sum[0]=HexDigit(Check>>4); Sum[1]=HexDigit(Check&0x0F); }
+  }
+}
+
+int main(int argc, char *argv[])
+{ int Lines = argc>1 ? atoi(argv[1]):200000;
+  const char *FileName = "/tmp/nmea_bulk_test.log";
+  srand(1);
+  FILE *File=fopen(FileName, "wb"); if(File==0) { printf("Cannot write %s\n", FileName); return 1; }
+  for(int Idx=0; Idx<Lines; Idx++)
+  { char Line[256]; int Len; int Kind=rand()%16;
+         if(Kind<8)  Len=RandomPOGNT(Line);
+    else if(Kind<13) Len=RandomGPS(Line);
+    else if(Kind<15) Len=sprintf(Line, "%s", Other[rand()%5]);
+    else { Len=sprintf(Line, "Comment: "); while(Len<200) Line[Len++]='a'+rand()%26;         // a long line: skipped
+           Line[Len++]='\n'; }
+    if(rand()%16==0 && Len>4) Mutate(Line, Len);
+    if(Idx==Lines-1) { while(Len && (Line[Len-1]=='\n' || Line[Len-1]=='\r')) Len--; } // the last line without '\n'
+    fwrite(Line, 1, Len, File); }
+  fclose(File);
+
+  LogFile_Map Log;
+  if(Log.Open(FileName)<0) { printf("Cannot map %s\n", FileName); return 1; }
+
+  NMEA_BulkReader Bulk;
+  double BulkTime=0; const int Reps=5;
+  for(int Rep=0; Rep<Reps; Rep++)
+  { double Start=Wall_Time();
+    if(!Bulk.Parse(Log.Data, Log.Size)) { printf("Cannot allocate the columns\n"); return 1; }
+    BulkTime+=Wall_Time()-Start; }
+  BulkTime/=Reps;
+
+  double LineTime=0; uint32_t Accepted=0;                      // the per-line readers alone
+  for(int Rep=0; Rep<Reps; Rep++)
+  { GPS_Position Position; Position.Clear();
+    double Start=Wall_Time();
+    for(size_t Ptr=0; Ptr<Log.Size; )
+    { char Line[256]; int Len;
+      Ptr=GetLine(Line, Len, Log, Ptr);
+      if(Len>=NMEA_BulkLine::MaxLen) continue;
+      OGN_RxPacket Packet; Packet.Clear();
+      if(Packet.ReadPOGNT(Line)!=(uint8_t)(-1)) Accepted++;
+      else if(Position.ReadNMEA(Line)==1) Accepted++; }
+    LineTime+=Wall_Time()-Start; }
+  LineTime/=Reps;
+
+  int Errors=0;                                                 // the per-line readers against the columns
+  size_t POGNT=0, GPS=0; uint32_t LineIdx=0;
+  GPS_Position Position; Position.Clear();
+  for(size_t Ptr=0; Ptr<Log.Size; LineIdx++)
+  { char Line[256]; int Len;
+    Ptr=GetLine(Line, Len, Log, Ptr);
+    if(Len>=NMEA_BulkLine::MaxLen) continue;
+    OGN_RxPacket Packet; Packet.Clear();
+    if(Packet.ReadPOGNT(Line)!=(uint8_t)(-1))
+    { OGN_RxPacket Row;
+      if(POGNT>=Bulk.POGNT.Rows || Bulk.POGNT.Line[POGNT]!=LineIdx) { Errors++; continue; }
+      Bulk.POGNT.getPacket(Row, POGNT);
+      if(memcmp(Row.Byte(), Packet.Byte(), OGN_Packet::Bytes) || Row.RxRSSI!=Packet.RxRSSI || Row.RxErr!=Packet.RxErr)
+      { if(Errors<10) printf("POGNT %d: %s\n", LineIdx, Line);
+        Errors++; }
+      POGNT++; continue; }
+    if(Position.ReadNMEA(Line)==1)
+    { const GPS_Columns &Col=Bulk.GPS;
+      if(GPS>=Col.Rows || Col.Line[GPS]!=LineIdx) { Errors++; continue; }
+      size_t Row=GPS;
+      if( Col.hasGPS[Row]!=Position.hasGPS || Col.FixQuality[Row]!=Position.FixQuality || Col.FixMode[Row]!=Position.FixMode
+       || Col.Satellites[Row]!=Position.Satellites
+       || Col.Year[Row]!=Position.Year || Col.Month[Row]!=Position.Month || Col.Day[Row]!=Position.Day
+       || Col.Hour[Row]!=Position.Hour || Col.Min[Row]!=Position.Min || Col.Sec[Row]!=Position.Sec || Col.FracSec[Row]!=Position.FracSec
+       || Col.PDOP[Row]!=Position.PDOP || Col.HDOP[Row]!=Position.HDOP || Col.VDOP[Row]!=Position.VDOP
+       || Col.Speed[Row]!=Position.Speed || Col.Heading[Row]!=Position.Heading || Col.GeoidSeparation[Row]!=Position.GeoidSeparation
+       || Col.Altitude[Row]!=Position.Altitude || Col.Latitude[Row]!=Position.Latitude || Col.Longitude[Row]!=Position.Longitude )
+      { if(Errors<10) printf("GPS %d: %s\n", LineIdx, Line);
+        Errors++; }
+      GPS++; }
+  }
+  if(POGNT!=Bulk.POGNT.Rows || GPS!=Bulk.GPS.Rows || LineIdx!=Bulk.Lines || Accepted!=Reps*(POGNT+GPS)) Errors++;
+
+  printf("%d lines, %d $POGNT, %d GPS, %d bad, %d long: %d errors\n",
+         Bulk.Lines, (int)Bulk.POGNT.Rows, (int)Bulk.GPS.Rows, Bulk.Bad, Bulk.Long, Errors);
+  printf("per-line readers: %7.1f MB/s\n", 1e-6*Log.Size/LineTime);
+  printf("bulk reader:      %7.1f MB/s (x%3.1f)\n", 1e-6*Log.Size/BulkTime, LineTime/BulkTime);
+  Log.Close(); remove(FileName);
+  return Errors ? 1:0; }
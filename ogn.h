@@ -20,6 +20,7 @@
 #include "ldpc.h"
 
 #include "format.h"
+#include "cobs.h"
 
 /*
 class OGN_SlowPacket       // "slow packet" for transmitting position encoded in packet transmission times
@@ -424,34 +425,35 @@ class OGN_Packet           // Packet structure for the OGN tracker
      return WritePFLAA(NMEA, Status, LatDist, LonDist, AltDist, Status); }                            // return number of formatted characters
 
    uint8_t WritePFLAA(char *NMEA, uint8_t Status, int32_t LatDist, int32_t LonDist, int32_t AltDist)
-   { uint8_t Len=0;
-     Len+=Format_String(NMEA+Len, "$PFLAA,");                    // sentence name and alarm-level (but no alarms for trackers)
-     NMEA[Len++]='0'+Status;
-     NMEA[Len++]=',';
-     Len+=Format_SignDec(NMEA+Len, LatDist);
-     NMEA[Len++]=',';
-     Len+=Format_SignDec(NMEA+Len, LonDist);
-     NMEA[Len++]=',';
-     Len+=Format_SignDec(NMEA+Len, AltDist);                       // [m] relative altitude
-     NMEA[Len++]=',';
-     NMEA[Len++]='0'+Header.AddrType;                              // address-type (3=OGN)
-     NMEA[Len++]=',';
-     uint32_t Addr = Header.Address;                               // [24-bit] address
-     Len+=Format_Hex(NMEA+Len, (uint8_t)(Addr>>16));               // XXXXXX 24-bit address: RND, ICAO, FLARM, OGN
-     Len+=Format_Hex(NMEA+Len, (uint16_t)Addr);
-     NMEA[Len++]=',';
-     Len+=Format_UnsDec(NMEA+Len, DecodeHeading(), 4, 1);          // [deg] heading (by GPS)
-     NMEA[Len++]=',';
-     Len+=Format_SignDec(NMEA+Len, DecodeTurnRate(), 2, 1);        // [deg/sec] turn rate
-     NMEA[Len++]=',';
-     Len+=Format_UnsDec(NMEA+Len, DecodeSpeed(), 2, 1);            // [approx. m/s] ground speed
-     NMEA[Len++]=',';
-     Len+=Format_SignDec(NMEA+Len, DecodeClimbRate(), 2, 1);       // [m/s] climb/sink rate
-     NMEA[Len++]=',';
-     NMEA[Len++]=HexDigit(Position.AcftType);                      // [0..F] aircraft-type: 1=glider, 2=tow plane, etc.
-     Len+=NMEA_AppendCheckCRNL(NMEA, Len);
-     NMEA[Len]=0;
-     return Len; }                                                 // return number of formatted characters
+   { NMEA_Builder Sentence;
+     WritePFLAA(Sentence, Status, LatDist, LonDist, AltDist);
+     return Sentence.Copy(NMEA); }                                 // return number of formatted characters
+
+   uint8_t WritePFLAA(NMEA_Builder &NMEA, uint8_t Status, int32_t LatDist, int32_t LonDist, int32_t AltDist)
+   { NMEA.Start("PFLAA");                                          // sentence name and alarm-level (but no alarms for trackers)
+     NMEA.Comma();
+     NMEA.Digit(Status);
+     NMEA.Comma();
+     NMEA.SignDec(LatDist);
+     NMEA.Comma();
+     NMEA.SignDec(LonDist);
+     NMEA.Comma();
+     NMEA.SignDec(AltDist);                                        // [m] relative altitude
+     NMEA.Comma();
+     NMEA.Digit(Header.AddrType);                                  // address-type (3=OGN)
+     NMEA.Comma();
+     NMEA.Hex(Header.Address, 6);                                  // XXXXXX 24-bit address: RND, ICAO, FLARM, OGN
+     NMEA.Comma();
+     NMEA.UnsDec(DecodeHeading(), 4, 1);                           // [deg] heading (by GPS)
+     NMEA.Comma();
+     NMEA.SignDec(DecodeTurnRate(), 2, 1);                         // [deg/sec] turn rate
+     NMEA.Comma();
+     NMEA.UnsDec(DecodeSpeed(), 2, 1);                             // [approx. m/s] ground speed
+     NMEA.Comma();
+     NMEA.SignDec(DecodeClimbRate(), 2, 1);                        // [m/s] climb/sink rate
+     NMEA.Comma();
+     NMEA.HexDigit(Position.AcftType);                             // [0..F] aircraft-type: 1=glider, 2=tow plane, etc.
+     return NMEA.Finish(); }                                       // return number of formatted characters
 
    uint8_t Print(char *Out) const
    { uint8_t Len=0;
@@ -477,27 +479,8 @@ class OGN_Packet           // Packet structure for the OGN tracker
      Out[Len++]='\n'; Out[Len]=0;
      return Len; }
 
-   static uint8_t PrintLatitude(char *Out, int32_t Lat)
-   { uint8_t Len=0;
-     char Sign='N';
-     if(Lat<0) { Sign='S'; Lat=(-Lat); }
-     uint32_t Deg=Lat/600000;
-     Lat -= 600000*Deg;
-     Len+=Format_UnsDec(Out+Len, Deg, 2, 0);
-     Len+=Format_UnsDec(Out+Len, Lat, 6, 4);
-     Out[Len++]=Sign;
-     return Len; }
-
-   static uint8_t PrintLongitude(char *Out, int32_t Lon)
-   { uint8_t Len=0;
-     char Sign='E';
-     if(Lon<0) { Sign='W'; Lon=(-Lon); }
-     uint32_t Deg=Lon/600000;
-     Lon -= 600000*Deg;
-     Len+=Format_UnsDec(Out+Len, Deg, 3, 0);
-     Len+=Format_UnsDec(Out+Len, Lon, 6, 4);
-     Out[Len++]=Sign;
-     return Len; }
+   static uint8_t PrintLatitude (char *Out, int32_t Lat) { return Format_Latitude (Out, Lat); } // DDMM.MMMMs
+   static uint8_t PrintLongitude(char *Out, int32_t Lon) { return Format_Longitude(Out, Lon); } // DDDMM.MMMMs
 
    // OGN_Packet() { Clear(); }
    void Clear(void) { HeaderWord=0; Data[0]=0; Data[1]=0; Data[2]=0; Data[3]=0; }
@@ -517,6 +500,82 @@ class OGN_Packet           // Packet structure for the OGN tracker
    void EncodeStdAltitude(int32_t StdAlt) { setBaroAltDiff((StdAlt-DecodeAltitude())); }
    int32_t DecodeStdAltitude(void) const { return (DecodeAltitude()+getBaroAltDiff()); }
 
+   // Variable resolution: values below 2^Bits are kept as they are, the three next ranges, each twice as wide as the one before,
+   // with steps of 2, 4 and 8, the values beyond saturate. Value+2^Bits tells the range by its highest bit (CLZ on Cortex-M3),
+   // thus there are no comparison chains: Encode = range on top, mantissa below; Decode = middle of the step.
+   // VarResCLZ is always compiled (ogn_codec_test checks it against the comparison chains on any host),
+   // but the packet codecs below take it only where there is a count-leading-zeros instruction.
+   class VarResCLZ
+   { public:
+     template <int Bits>
+      static uint16_t EncodeUR2V(uint16_t Value)                               // Encode unsigned (0..15*2^Bits-1) as Bits+2 bits
+     { const uint32_t Base = 1<<Bits;
+       uint32_t Ext = Value+Base; Ext = Ext<16*Base ? Ext:16*Base-1;            // saturate: the last code of range #3
+       uint8_t Range = 31-__builtin_clz(Ext)-Bits;                              // 0..3
+       return (Range<<Bits) + (Ext>>Range) - Base; }
+
+     template <int Bits>
+      static uint16_t DecodeUR2V(uint16_t Range, uint16_t Value)               // Range = 0..3, Value = Bits-bit mantissa
+     { const uint16_t Base = 1<<Bits;
+       return ((Base+Value)<<Range) - Base + ((1<<Range)>>1); }
+
+     static uint16_t EncodeUR2V8(uint16_t Value) { return EncodeUR2V<8>(Value); } // Encode unsigned 12bit (0..3832) as 10bit
+
+     static uint16_t DecodeUR2V8(uint16_t Value)                               // Decode 10bit 0..0x3FF
+     { uint16_t Range = Value>>8; Range = Range<3 ? Range:3;
+       return DecodeUR2V<8>(Range, Value&0x0FF); }                             // in 12bit (0..3832)
+
+     static uint8_t EncodeUR2V5(uint16_t Value) { return EncodeUR2V<5>(Value); } // Encode unsigned 9bit (0..472) as 7bit
+
+     static uint16_t DecodeUR2V5(uint16_t Value)                               // Decode 7bit as unsigned 9bit (0..472)
+     { return DecodeUR2V<5>((Value>>5)&0x03, Value&0x1F); }
+
+     static uint8_t EncodeSR2V5(int16_t Value)                                // Encode signed 10bit (-472..+472) as 8bit
+     { int16_t Sign = Value>>15;                                               // 0 or -1
+       return EncodeUR2V5((Value^Sign)-Sign) | (Sign&0x80); }
+
+     static  int16_t DecodeSR2V5( int16_t Value)                              // Decode
+     { int16_t Sign = -((Value>>7)&1);
+       int16_t Abs  = DecodeUR2V5(Value&0x7F);
+       return (Abs^Sign)-Sign; }
+
+     static uint16_t EncodeUR2V6(uint16_t Value) { return EncodeUR2V<6>(Value); } // Encode unsigned 10bit (0..952) as 8 bit
+
+     static uint16_t DecodeUR2V6(uint16_t Value)                              // Decode 8bit as unsigned 10bit (0..952)
+     { return DecodeUR2V<6>((Value>>6)&0x03, Value&0x3F); }
+
+     static uint16_t EncodeSR2V6(int16_t Value)                               // Encode signed 11bit (-952..+952) as 9bit
+     { int16_t Sign = Value>>15;
+       return EncodeUR2V6((Value^Sign)-Sign) | (Sign&0x100); }
+
+     static  int16_t DecodeSR2V6( int16_t Value)                              // Decode 9bit as signed 11bit (-952..+952)
+     { int16_t Sign = -((Value>>8)&1);
+       int16_t Abs  = DecodeUR2V6(Value&0x00FF);
+       return (Abs^Sign)-Sign; }
+
+     static uint16_t EncodeUR2V12(uint16_t Value) { return EncodeUR2V<12>(Value); } // encode unsigned 16-bit (0..61432) as 14-bit
+
+     static uint16_t DecodeUR2V12(uint16_t Value)
+     { uint16_t Range = Value>>12; Range = Range<3 ? Range:3;
+       return DecodeUR2V<12>(Range, Value&0x0FFF); }                           // max: 61432
+   } ;
+
+#if defined(__ARM_FEATURE_CLZ) || defined(__LZCNT__)                         // CLZ on Cortex-M3, LZCNT on x86-64 with -march=native
+   static const bool VarResWithCLZ = 1;
+   static uint16_t EncodeUR2V8(uint16_t Value)  { return VarResCLZ::EncodeUR2V8(Value); }
+   static uint16_t DecodeUR2V8(uint16_t Value)  { return VarResCLZ::DecodeUR2V8(Value); }
+   static uint8_t  EncodeUR2V5(uint16_t Value)  { return VarResCLZ::EncodeUR2V5(Value); }
+   static uint16_t DecodeUR2V5(uint16_t Value)  { return VarResCLZ::DecodeUR2V5(Value); }
+   static uint8_t  EncodeSR2V5( int16_t Value)  { return VarResCLZ::EncodeSR2V5(Value); }
+   static  int16_t DecodeSR2V5( int16_t Value)  { return VarResCLZ::DecodeSR2V5(Value); }
+   static uint16_t EncodeUR2V6(uint16_t Value)  { return VarResCLZ::EncodeUR2V6(Value); }
+   static uint16_t DecodeUR2V6(uint16_t Value)  { return VarResCLZ::DecodeUR2V6(Value); }
+   static uint16_t EncodeSR2V6( int16_t Value)  { return VarResCLZ::EncodeSR2V6(Value); }
+   static  int16_t DecodeSR2V6( int16_t Value)  { return VarResCLZ::DecodeSR2V6(Value); }
+   static uint16_t EncodeUR2V12(uint16_t Value) { return VarResCLZ::EncodeUR2V12(Value); }
+   static uint16_t DecodeUR2V12(uint16_t Value) { return VarResCLZ::DecodeUR2V12(Value); }
+#else                                                                          // without a count-leading-zeros instruction the comparison chains are faster
+   static const bool VarResWithCLZ = 0;
    static uint16_t EncodeUR2V8(uint16_t Value)                                 // Encode unsigned 12bit (0..3832) as 10bit
    {      if(Value<0x100) { }
      else if(Value<0x300) Value = 0x100 | ((Value-0x100)>>1);
@@ -531,7 +590,7 @@ class OGN_Packet           // Packet structure for the OGN tracker
      if(Range==0) return Value;              // 000..0FF
      if(Range==1) return 0x101+(Value<<1);   // 100..2FE
      if(Range==2) return 0x302+(Value<<2);   // 300..6FC
-                  return 0x704+(Value<<3); } // 700..EF8                       // in 12bit (0..3832)
+     return 0x704+(Value<<3); } // 700..EF8                       // in 12bit (0..3832)
 
    static uint8_t EncodeUR2V5(uint16_t Value)                                  // Encode unsigned 9bit (0..472) as 7bit
    {      if(Value<0x020) { }
@@ -586,6 +645,7 @@ class OGN_Packet           // Packet structure for the OGN tracker
    { int16_t Sign =  Value&0x100;
      Value = DecodeUR2V6(Value&0x00FF);
      return Sign ? -Value: Value; }
+#endif
 
    void EncodeLatitude(int32_t Latitude)                                // encode Latitude: units are 0.0001/60 degrees
    { Position.Latitude = Latitude>>3; }
@@ -603,6 +663,7 @@ class OGN_Packet           // Packet structure for the OGN tracker
      // if(Longitude&0x00800000) Longitude|=0xFF000000;
      Longitude = (Longitude<<4)+8; return Longitude; }
 
+#if !defined(__ARM_FEATURE_CLZ) && !defined(__LZCNT__)
    static uint16_t EncodeUR2V12(uint16_t Value)                        // encode unsigned 16-bit (0..61432) as 14-bit
    {      if(Value<0x1000) { }
      else if(Value<0x3000) Value = 0x1000 | ((Value-0x1000)>>1);
@@ -617,7 +678,8 @@ class OGN_Packet           // Packet structure for the OGN tracker
      if(Range==0) return         Value;       // 0000..0FFF
      if(Range==1) return 0x1001+(Value<<1);   // 1000..2FFE
      if(Range==2) return 0x3002+(Value<<2);   // 3000..6FFC
-                  return 0x7004+(Value<<3); } // 7000..EFF8 => max: 61432
+     return 0x7004+(Value<<3); } // 7000..EFF8 => max: 61432
+#endif
 
    void EncodeAltitude(int32_t Altitude)                               // encode altitude in meters
    { if(Altitude<0)      Altitude=0;
@@ -770,6 +832,61 @@ class OGN_Packet           // Packet structure for the OGN tracker
      Data[0]=v0; Data[1]=v1;
    }
 
+   // batch whitening: the TEA cycles run interleaved over the blocks of several packets, two blocks per packet.
+   // The lanes are a GCC vector: SSE/AVX/NEON on the hosts, on the Cortex-M3 a pair of registers for one packet.
+   // Bit-exact with Whiten()/Dewhiten() packet by packet.
+#if defined(__ARM_ARCH_7M__) || defined(__AVR__)
+   typedef uint32_t TEA_Vector __attribute__ ((vector_size (8)));  // one packet: 2 blocks
+#elif defined(__AVX512F__)
+   typedef uint32_t TEA_Vector __attribute__ ((vector_size (64))); // eight packets: 16 blocks
+#elif defined(__AVX__)
+   typedef uint32_t TEA_Vector __attribute__ ((vector_size (32))); // four packets
+#else
+   typedef uint32_t TEA_Vector __attribute__ ((vector_size (16))); // two packets: SSE2, NEON
+#endif
+   static const int TEA_Lanes = sizeof(TEA_Vector)/sizeof(uint32_t);
+
+   static void TEA_Encrypt_Key0 (TEA_Vector &V0, TEA_Vector &V1, int Loops=4) // TEA_Encrypt_Key0() on TEA_Lanes blocks
+   { const uint32_t delta=0x9e3779b9; uint32_t sum=0;
+     for (int i=0; i < Loops; i++)
+     { sum += delta;
+       V0 += (V1<<4) ^ (V1 + sum) ^ (V1>>5);
+       V1 += (V0<<4) ^ (V0 + sum) ^ (V0>>5); }
+   }
+
+   static void TEA_Decrypt_Key0 (TEA_Vector &V0, TEA_Vector &V1, int Loops=4) // TEA_Decrypt_Key0() on TEA_Lanes blocks
+   { const uint32_t delta=0x9e3779b9; uint32_t sum=delta*Loops;
+     for (int i=0; i < Loops; i++)
+     { V1 -= (V0<<4) ^ (V0 + sum) ^ (V0>>5);
+       V0 -= (V1<<4) ^ (V1 + sum) ^ (V1>>5);
+       sum -= delta; }
+   }
+
+   template <class Pkt, OGN_Packet &(*Get)(Pkt &), bool Encrypt>
+    static void TEA_Batch(Pkt *Packet, int Packets)
+   { const int PerGroup = TEA_Lanes/2;                      // packets per group of lanes
+     int Idx=0;
+     for( ; Idx+PerGroup<=Packets; Idx+=PerGroup)
+     { TEA_Vector V0, V1;
+       for(int L=0; L<PerGroup; L++)                        // gather: the first blocks to the lower lanes, the second to the upper
+       { const uint32_t *Data = Get(Packet[Idx+L]).Data;
+         V0[L]=Data[0]; V1[L]=Data[1]; V0[PerGroup+L]=Data[2]; V1[PerGroup+L]=Data[3]; }
+       if(Encrypt) TEA_Encrypt_Key0(V0, V1, 8);
+              else TEA_Decrypt_Key0(V0, V1, 8);
+       for(int L=0; L<PerGroup; L++)                        // scatter
+       { uint32_t *Data = Get(Packet[Idx+L]).Data;
+         Data[0]=V0[L]; Data[1]=V1[L]; Data[2]=V0[PerGroup+L]; Data[3]=V1[PerGroup+L]; }
+     }
+     for( ; Idx<Packets; Idx++)                             // the remaining packets one by one
+     { if(Encrypt) Get(Packet[Idx]).Whiten();
+              else Get(Packet[Idx]).Dewhiten(); }
+   }
+
+   static OGN_Packet &Self(OGN_Packet &Packet) { return Packet; }
+
+   static void Whiten  (OGN_Packet *Packet, int Packets) { TEA_Batch<OGN_Packet, Self, 1>(Packet, Packets); } // whiten an array of packets
+   static void Dewhiten(OGN_Packet *Packet, int Packets) { TEA_Batch<OGN_Packet, Self, 0>(Packet, Packets); } // de-whiten an array of packets
+
    static uint8_t Gray(uint8_t Binary) { return Binary ^ (Binary>>1); }
 
    static uint8_t Binary(uint8_t Gray)
@@ -803,6 +920,12 @@ class OGN_TxPacket                                    // OGN packet with FEC cod
 
   public:
 
+   static OGN_Packet &getPacket(OGN_TxPacket &TxPacket) { return TxPacket.Packet; }
+   static void Whiten(OGN_TxPacket *TxPacket, int Packets)                // whiten an array of packets for transmission
+   { OGN_Packet::TEA_Batch<OGN_TxPacket, getPacket, 1>(TxPacket, Packets); }
+   static void Dewhiten(OGN_TxPacket *TxPacket, int Packets)              // de-whiten an array of packets
+   { OGN_Packet::TEA_Batch<OGN_TxPacket, getPacket, 0>(TxPacket, Packets); }
+
    uint8_t Print(char *Out)
    { uint8_t Len=0;
      Out[Len++]=HexDigit(Packet.Position.AcftType); Out[Len++]=':';
@@ -890,6 +1013,10 @@ class OGN_RxPacket                                        // OGN packet with FEC
    OGN_RxPacket() { Clear(); }
    void Clear(void) { Packet.Clear(); State=0; Rank=0; }
 
+   static OGN_Packet &getPacket(OGN_RxPacket &RxPacket) { return RxPacket.Packet; }
+   static void Dewhiten(OGN_RxPacket *RxPacket, int Packets)              // de-whiten an array of received packets
+   { OGN_Packet::TEA_Batch<OGN_RxPacket, getPacket, 0>(RxPacket, Packets); }
+
    uint8_t  *Byte(void) const { return (uint8_t  *)&Packet.HeaderWord; } // packet as bytes
    uint32_t *Word(void) const { return (uint32_t *)&Packet.HeaderWord; } // packet as words
 
@@ -988,7 +1115,7 @@ class OGN_RxPacket                                        // OGN packet with FEC
      Len+=Ret+1;
 
      if(NMEA[Len+10]!=',') return -1;
-     int8_t Deg=Read_Dec2(NMEA+Len); if(Deg<0) return -1;
+     int16_t Deg=Read_Dec2(NMEA+Len); if(Deg<0) return -1;                // int16_t: the longitude below goes to 179
      int8_t Min=Read_Dec2(NMEA+Len+2); if(Min<0) return -1;
      if(NMEA[Len+4]!='.') return -1;
      int16_t Frac=Read_Dec4(NMEA+Len+5); if(Frac<0) return -1;
@@ -1063,49 +1190,94 @@ class OGN_RxPacket                                        // OGN packet with FEC
      return Len; }
 
    uint8_t WritePOGNT(char *NMEA)
-   { uint8_t Len=0;
-     Len+=Format_String(NMEA+Len, "$POGNT,");                             // sentence name
+   { NMEA_Builder Sentence;
+     WritePOGNT(Sentence);
+     return Sentence.Copy(NMEA); }
+
+   uint8_t WritePOGNT(NMEA_Builder &NMEA)
+   { NMEA.Start("POGNT");                                                  // sentence name
+     NMEA.Comma();
      if(Packet.Position.Time<60)
-       Len+=Format_UnsDec(NMEA+Len, (uint16_t)Packet.Position.Time, 2);   // [sec] time
-     NMEA[Len++]=',';
-     NMEA[Len++]=HexDigit(Packet.Position.AcftType);                      // [0..F] aircraft-type: 1=glider, 2=tow plane, etc.
-     NMEA[Len++]=',';
-     NMEA[Len++]='0'+Packet.Header.AddrType;                              // [0..3] address-type: 1=ICAO, 2=FLARM, 3=OGN
-     NMEA[Len++]=',';
-     uint32_t Addr = Packet.Header.Address;                               // [24-bit] address
-     Len+=Format_Hex(NMEA+Len, (uint8_t)(Addr>>16));
-     Len+=Format_Hex(NMEA+Len, (uint16_t)Addr);
-     NMEA[Len++]=',';
-     NMEA[Len++]='0'+Packet.Header.RelayCount;                            // [0..3] counts retransmissions
-     NMEA[Len++]=',';
-     NMEA[Len++]='0'+Packet.Position.FixQuality;                          // [] fix quality
-     NMEA[Len++]='0'+Packet.Position.FixMode;                             // [] fix mode
-     NMEA[Len++]=',';
-     Len+=Format_UnsDec(NMEA+Len, (uint16_t)(Packet.DecodeDOP()+10),2,1); // [] Dilution of Precision
-     NMEA[Len++]=',';
-     Len+=Packet.PrintLatitude(NMEA+Len, Packet.DecodeLatitude());        // [] Latitude
-     NMEA[Len++]=',';
-     Len+=Packet.PrintLongitude(NMEA+Len, Packet.DecodeLongitude());      // [] Longitude
-     NMEA[Len++]=',';
-     Len+=Format_UnsDec(NMEA+Len, (uint32_t)Packet.DecodeAltitude());     // [m] Altitude (by GPS)
-     NMEA[Len++]=',';
+       NMEA.UnsDec(Packet.Position.Time, 2);                               // [sec] time
+     NMEA.Comma();
+     NMEA.HexDigit(Packet.Position.AcftType);                              // [0..F] aircraft-type: 1=glider, 2=tow plane, etc.
+     NMEA.Comma();
+     NMEA.Digit(Packet.Header.AddrType);                                   // [0..3] address-type: 1=ICAO, 2=FLARM, 3=OGN
+     NMEA.Comma();
+     NMEA.Hex(Packet.Header.Address, 6);                                   // [24-bit] address
+     NMEA.Comma();
+     NMEA.Digit(Packet.Header.RelayCount);                                 // [0..3] counts retransmissions
+     NMEA.Comma();
+     NMEA.Digit(Packet.Position.FixQuality);                               // [] fix quality
+     NMEA.Digit(Packet.Position.FixMode);                                  // [] fix mode
+     NMEA.Comma();
+     NMEA.UnsDec(Packet.DecodeDOP()+10, 2, 1);                             // [] Dilution of Precision
+     NMEA.Comma();
+     NMEA.Latitude(Packet.DecodeLatitude());                               // [] Latitude
+     NMEA.Comma();
+     NMEA.Longitude(Packet.DecodeLongitude());                             // [] Longitude
+     NMEA.Comma();
+     NMEA.UnsDec(Packet.DecodeAltitude());                                 // [m] Altitude (by GPS)
+     NMEA.Comma();
      if(Packet.hasBaro())
-       Len+=Format_SignDec(NMEA+Len, (int32_t)Packet.getBaroAltDiff());   // [m] Standard Pressure Altitude (by Baro)
-     NMEA[Len++]=',';
-     Len+=Format_SignDec(NMEA+Len, Packet.DecodeClimbRate(), 2, 1);       // [m/s] climb/sink rate (by GPS or pressure sensor)
-     NMEA[Len++]=',';
-     Len+=Format_UnsDec(NMEA+Len, Packet.DecodeSpeed(), 2, 1);         // [m/s] ground speed (by GPS)
-     NMEA[Len++]=',';
-     Len+=Format_UnsDec(NMEA+Len, Packet.DecodeHeading(), 4, 1);          // [deg] heading (by GPS)
-     NMEA[Len++]=',';
-     Len+=Format_SignDec(NMEA+Len, Packet.DecodeTurnRate(), 2, 1);         // [deg/s] turning rate (by GPS)
-     NMEA[Len++]=',';
-     Len+=Format_SignDec(NMEA+Len, -(int16_t)RxRSSI/2);            // [dBm] received signal level
-     NMEA[Len++]=',';
-     Len+=Format_UnsDec(NMEA+Len, (uint16_t)RxErr);                // [bits] corrected transmisison errors
-     Len+=NMEA_AppendCheckCRNL(NMEA, Len);
-     NMEA[Len]=0;
-     return Len; }
+       NMEA.SignDec(Packet.getBaroAltDiff());                              // [m] Standard Pressure Altitude (by Baro)
+     NMEA.Comma();
+     NMEA.SignDec(Packet.DecodeClimbRate(), 2, 1);                         // [m/s] climb/sink rate (by GPS or pressure sensor)
+     NMEA.Comma();
+     NMEA.UnsDec(Packet.DecodeSpeed(), 2, 1);                              // [m/s] ground speed (by GPS)
+     NMEA.Comma();
+     NMEA.UnsDec(Packet.DecodeHeading(), 4, 1);                            // [deg] heading (by GPS)
+     NMEA.Comma();
+     NMEA.SignDec(Packet.DecodeTurnRate(), 2, 1);                          // [deg/s] turning rate (by GPS)
+     NMEA.Comma();
+     NMEA.SignDec(-(int16_t)RxRSSI/2);                                     // [dBm] received signal level
+     NMEA.Comma();
+     NMEA.UnsDec(RxErr);                                                   // [bits] corrected transmisison errors
+     return NMEA.Finish(); }
+
+   // binary alternative to $POGNT+$PFLAA: a COBS frame of a fixed record, little-endian, with CRC-16 at the end:
+   // Type, Packet[20] (de-whitened), RxRSSI, RxErr, RxChan, DayTime[4] ([ms] reception time of the UTC day),
+   // LatDist[2], LonDist[2], AltDist[2] ([m] relative position as in $PFLAA)
+   static const uint8_t FrameType   = 0x01;                             // record type: received OGN packet
+   static const uint8_t FrameRecLen = 1+OGN_Packet::Bytes+3+4+3*2;       // [bytes] record without the CRC
+   static const uint8_t FrameMaxLen = 1+FrameRecLen+2+1+1;              // [bytes] with CRC, COBS code and the two delimiters
+
+   static void putFrame(uint8_t *Rec, uint32_t Value, uint8_t Bytes) { for( ; Bytes; Bytes--, Value>>=8) *Rec++ = Value; }
+   static uint32_t getFrame(const uint8_t *Rec, uint8_t Bytes) { uint32_t Value=0; while(Bytes--) Value = (Value<<8) | Rec[Bytes]; return Value; }
+   static int16_t Clip16(int32_t Value) { if(Value>0x7FFF) return 0x7FFF; if(Value<-0x7FFF) return -0x7FFF; return Value; }
+
+   uint8_t WriteFrame(uint8_t *Frame, uint32_t Time, uint16_t msTime, int32_t LatDist, int32_t LonDist, int32_t AltDist) const
+   { uint8_t Rec[FrameRecLen+2];                                        // Time, msTime: as in RFM_RxPktData
+     uint32_t DayTime = ((Time%86400)*1000+msTime)%86400000;
+     Rec[0]=FrameType;
+     memcpy(Rec+1, Byte(), OGN_Packet::Bytes);                          // the packet without the FEC
+     uint8_t Len=1+OGN_Packet::Bytes;
+     Rec[Len++]=RxRSSI; Rec[Len++]=RxErr; Rec[Len++]=RxChan;
+     putFrame(Rec+Len, DayTime, 4); Len+=4;
+     putFrame(Rec+Len, (uint16_t)Clip16(LatDist), 2); Len+=2;
+     putFrame(Rec+Len, (uint16_t)Clip16(LonDist), 2); Len+=2;
+     putFrame(Rec+Len, (uint16_t)Clip16(AltDist), 2); Len+=2;
+     putFrame(Rec+Len, CRC16_CCITT(Rec, Len), 2); Len+=2;
+     uint8_t FrameLen=0;
+     Frame[FrameLen++]=0;
+     FrameLen+=COBS_Encode(Frame+FrameLen, Rec, Len);
+     Frame[FrameLen++]=0;
+     return FrameLen; }                                                 // return number of bytes to send
+
+   bool ReadFrame(const uint8_t *Frame, uint8_t Len, uint32_t &DayTime, int16_t &LatDist, int16_t &LonDist, int16_t &AltDist)
+   { uint8_t Rec[FrameRecLen+2];                                        // Frame: the bytes between the zero delimiters
+     if(Len!=FrameRecLen+2+1) return 0;
+     if(COBS_Decode(Rec, Frame, Len)!=FrameRecLen+2) return 0;
+     if(getFrame(Rec+FrameRecLen, 2)!=CRC16_CCITT(Rec, FrameRecLen)) return 0;
+     if(Rec[0]!=FrameType) return 0;
+     memcpy(Byte(), Rec+1, OGN_Packet::Bytes);
+     uint8_t Idx=1+OGN_Packet::Bytes;
+     RxRSSI=Rec[Idx++]; RxErr=Rec[Idx++]; RxChan=Rec[Idx++];
+     DayTime = getFrame(Rec+Idx, 4); Idx+=4;
+     LatDist = getFrame(Rec+Idx, 2); Idx+=2;
+     LonDist = getFrame(Rec+Idx, 2); Idx+=2;
+     AltDist = getFrame(Rec+Idx, 2); Idx+=2;
+     return 1; }
 
    void Print(void) const
    { printf("[%02d/%+6.1fdBm/%2d] ", RxChan, -0.5*RxRSSI, RxErr);
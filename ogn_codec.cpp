@@ -0,0 +1,161 @@
+#include <string.h>
+#include <math.h>
+
+#include "ogn_codec.h"
+
+#include "ogn.h"
+#include "freqplan.h"
+
+// The packets go through in blocks: copied into aligned OGN_TxPacket's, where the firmware code works on them,
+// small enough that the block stays in L1 between the stages.
+
+static const int BlockSize = 64;
+
+static int Load(OGN_TxPacket *Block, const uint8_t *&Packet, int &Packets, int Stride) // copy the next block in, returns its size
+{ int Size = Packets<BlockSize ? Packets:BlockSize;
+  for(int Idx=0; Idx<Size; Idx++, Packet+=Stride)
+  { Block[Idx].FEC[1]=0; memcpy(Block[Idx].Byte(), Packet, OGN_CodecBytes); }
+  Packets-=Size; return Size; }
+
+static void Store(uint8_t *Packet, const OGN_TxPacket *Block, int Size, int Stride, int Bytes=OGN_CodecBytes)
+{ for(int Idx=0; Idx<Size; Idx++, Packet+=Stride)
+    memcpy(Packet, Block[Idx].Byte(), Bytes); }
+
+static uint8_t CheckFEC(const OGN_TxPacket &Pkt)        // same as checkFEC() but correct packets take one (table) encode
+{ uint32_t Parity[2] = { 0, 0 };                         // the parity part of the check matrix is invertible:
+  LDPC_Encode(Pkt.Packet.Word(), Parity);                // all checks pass exactly when the FEC is the one of the data
+  if( Parity[0]==Pkt.FEC[0] && ((Parity[1]^Pkt.FEC[1])&0xFFFF)==0 ) return 0;
+  return Pkt.checkFEC(); }                               // otherwise count the failed checks
+
+static int CheckBlock(uint8_t *Check, const OGN_TxPacket *Block, int Size)
+{ int Good=0;
+  for(int Idx=0; Idx<Size; Idx++)
+  { uint8_t Bad=CheckFEC(Block[Idx]); Good+=(Bad==0);
+    if(Check) Check[Idx]=Bad; }
+  return Good; }
+
+// field by field over the block: the inner loops have no branches
+static void ExtractBlock(const OGN_CodecFields &F, int Ofs, const OGN_TxPacket *Block, int Size)
+{ if(F.Address)    for(int Idx=0; Idx<Size; Idx++) F.Address   [Ofs+Idx] = Block[Idx].Packet.Header.Address;
+  if(F.AddrType)   for(int Idx=0; Idx<Size; Idx++) F.AddrType  [Ofs+Idx] = Block[Idx].Packet.Header.AddrType;
+  if(F.Other)      for(int Idx=0; Idx<Size; Idx++) F.Other     [Ofs+Idx] = Block[Idx].Packet.Header.Other;
+  if(F.Relay)      for(int Idx=0; Idx<Size; Idx++) F.Relay     [Ofs+Idx] = Block[Idx].Packet.Header.RelayCount;
+  if(F.Time)       for(int Idx=0; Idx<Size; Idx++) F.Time      [Ofs+Idx] = Block[Idx].Packet.Position.Time;
+  if(F.AcftType)   for(int Idx=0; Idx<Size; Idx++) F.AcftType  [Ofs+Idx] = Block[Idx].Packet.Position.AcftType;
+  if(F.FixQuality) for(int Idx=0; Idx<Size; Idx++) F.FixQuality[Ofs+Idx] = Block[Idx].Packet.Position.FixQuality;
+  if(F.FixMode)    for(int Idx=0; Idx<Size; Idx++) F.FixMode   [Ofs+Idx] = Block[Idx].Packet.Position.FixMode;
+  if(F.Latitude)   for(int Idx=0; Idx<Size; Idx++) F.Latitude  [Ofs+Idx] = Block[Idx].Packet.DecodeLatitude();
+  if(F.Longitude)  for(int Idx=0; Idx<Size; Idx++) F.Longitude [Ofs+Idx] = Block[Idx].Packet.DecodeLongitude();
+  if(F.Altitude)   for(int Idx=0; Idx<Size; Idx++) F.Altitude  [Ofs+Idx] = Block[Idx].Packet.DecodeAltitude();
+  if(F.BaroAltDiff)
+    for(int Idx=0; Idx<Size; Idx++)
+    { const OGN_Packet &Pkt = Block[Idx].Packet;
+      F.BaroAltDiff[Ofs+Idx] = Pkt.hasBaro() ? Pkt.getBaroAltDiff() : OGN_NoBaro; }
+  if(F.DOP)        for(int Idx=0; Idx<Size; Idx++) F.DOP       [Ofs+Idx] = 0.1f*(10+Block[Idx].Packet.DecodeDOP());
+  if(F.Speed)      for(int Idx=0; Idx<Size; Idx++) F.Speed     [Ofs+Idx] = 0.1f*Block[Idx].Packet.DecodeSpeed();
+  if(F.Heading)    for(int Idx=0; Idx<Size; Idx++) F.Heading   [Ofs+Idx] = 0.1f*Block[Idx].Packet.DecodeHeading();
+  if(F.ClimbRate)  for(int Idx=0; Idx<Size; Idx++) F.ClimbRate [Ofs+Idx] = 0.1f*Block[Idx].Packet.DecodeClimbRate();
+  if(F.TurnRate)   for(int Idx=0; Idx<Size; Idx++) F.TurnRate  [Ofs+Idx] = 0.1f*Block[Idx].Packet.DecodeTurnRate();
+}
+
+template <class Type>
+ static Type Get(const Type *Field, int Idx) { return Field ? Field[Idx]:0; }
+
+static int16_t Tenths(const float *Field, int Idx) { return Field ? (int16_t)lrintf(10*Field[Idx]):0; }
+
+static void EncodeBlock(OGN_TxPacket *Block, const OGN_CodecFields &F, int Ofs, int Size)
+{ for(int Idx=0; Idx<Size; Idx++)
+  { OGN_Packet &Pkt = Block[Idx].Packet; int Src=Ofs+Idx;
+    Pkt.Clear();
+    Pkt.Header.Address    = Get(F.Address, Src);
+    Pkt.Header.AddrType   = Get(F.AddrType, Src);
+    Pkt.Header.RelayCount = Get(F.Relay, Src);
+    Pkt.calcAddrParity();
+    Pkt.Position.Time       = Get(F.Time, Src);
+    Pkt.Position.AcftType   = Get(F.AcftType, Src);
+    Pkt.Position.FixQuality = Get(F.FixQuality, Src);
+    Pkt.Position.FixMode    = Get(F.FixMode, Src);
+    Pkt.EncodeLatitude(Get(F.Latitude, Src));
+    Pkt.EncodeLongitude(Get(F.Longitude, Src));
+    Pkt.EncodeAltitude(Get(F.Altitude, Src));
+    int16_t AltDiff = F.BaroAltDiff ? F.BaroAltDiff[Src] : OGN_NoBaro;
+    if(AltDiff==OGN_NoBaro) Pkt.clrBaro();
+                       else Pkt.setBaroAltDiff(AltDiff);
+    int16_t DOP = Tenths(F.DOP, Src)-10; if(DOP<0) DOP=0; else if(DOP>255) DOP=255;
+    Pkt.EncodeDOP(DOP);
+    Pkt.EncodeSpeed(Tenths(F.Speed, Src));
+    int16_t Heading = Tenths(F.Heading, Src)%3600; if(Heading<0) Heading+=3600;
+    Pkt.EncodeHeading(Heading);
+    Pkt.EncodeClimbRate(Tenths(F.ClimbRate, Src));
+    Pkt.EncodeTurnRate(Tenths(F.TurnRate, Src)); }
+  OGN_TxPacket::Whiten(Block, Size);
+  for(int Idx=0; Idx<Size; Idx++) Block[Idx].calcFEC(); }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+int OGN_CheckFEC(uint8_t *Check, const uint8_t *Packet, int Packets, int Stride)
+{ OGN_TxPacket Block[BlockSize]; int Good=0;
+  for(int Ofs=0; Packets>0; )
+  { int Size=Load(Block, Packet, Packets, Stride);
+    Good+=CheckBlock(Check ? Check+Ofs:0, Block, Size);
+    Ofs+=Size; }
+  return Good; }
+
+static void TEA_Blocks(uint8_t *Packet, int Packets, int Stride, bool Encrypt)
+{ OGN_TxPacket Block[BlockSize];
+  while(Packets>0)
+  { uint8_t *Out=Packet; const uint8_t *Inp=Packet;
+    int Size=Load(Block, Inp, Packets, Stride);
+    if(Encrypt) OGN_TxPacket::Whiten(Block, Size);
+           else OGN_TxPacket::Dewhiten(Block, Size);
+    Store(Out, Block, Size, Stride, OGN_Packet::Bytes);
+    Packet=(uint8_t *)Inp; }
+}
+
+void OGN_Whiten  (uint8_t *Packet, int Packets, int Stride) { TEA_Blocks(Packet, Packets, Stride, 1); }
+void OGN_Dewhiten(uint8_t *Packet, int Packets, int Stride) { TEA_Blocks(Packet, Packets, Stride, 0); }
+
+void OGN_Extract(const OGN_CodecFields &Fields, const uint8_t *Packet, int Packets, int Stride)
+{ OGN_TxPacket Block[BlockSize];
+  for(int Ofs=0; Packets>0; )
+  { int Size=Load(Block, Packet, Packets, Stride);
+    ExtractBlock(Fields, Ofs, Block, Size);
+    Ofs+=Size; }
+}
+
+int OGN_Decode(const OGN_CodecFields &Fields, const uint8_t *Packet, int Packets, int Stride)
+{ OGN_TxPacket Block[BlockSize]; int Good=0;
+  for(int Ofs=0; Packets>0; )
+  { int Size=Load(Block, Packet, Packets, Stride);
+    Good+=CheckBlock(Fields.Check ? Fields.Check+Ofs:0, Block, Size);
+    OGN_TxPacket::Dewhiten(Block, Size);
+    ExtractBlock(Fields, Ofs, Block, Size);
+    Ofs+=Size; }
+  return Good; }
+
+void OGN_Encode(uint8_t *Packet, const OGN_CodecFields &Fields, int Packets, int Stride)
+{ OGN_TxPacket Block[BlockSize];
+  for(int Ofs=0; Packets>0; )
+  { int Size = Packets<BlockSize ? Packets:BlockSize;
+    EncodeBlock(Block, Fields, Ofs, Size);
+    Store(Packet, Block, Size, Stride);
+    Packet+=Size*Stride; Ofs+=Size; Packets-=Size; }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+uint8_t OGN_CalcPlan(int32_t Latitude, int32_t Longitude) { return FreqPlan::calcPlan(Latitude, Longitude); }
+
+bool OGN_getPlan(OGN_CodecPlan &Plan, uint8_t Number)
+{ const char *Name=FreqPlan::getPlanName(Number); if(Name==0) return 0;
+  FreqPlan Freq; Freq.setPlan(Number);
+  Plan.Plan=Freq.Plan; Plan.Channels=Freq.Channels; Plan.BaseFreq=Freq.BaseFreq; Plan.ChanSepar=Freq.ChanSepar; Plan.Name=Name;
+  return 1; }
+
+void OGN_Channels(uint8_t *Channel, const uint32_t *Time, int Times, uint8_t Plan, uint8_t Slot, uint8_t OGN)
+{ FreqPlan Freq; Freq.setPlan(Plan);
+  for(int Idx=0; Idx<Times; Idx++) Channel[Idx]=Freq.getChannel(Time[Idx], Slot, OGN); }
+
+void OGN_Frequencies(uint32_t *Freq, const uint32_t *Time, int Times, uint8_t Plan, uint8_t Slot, uint8_t OGN)
+{ FreqPlan Hop; Hop.setPlan(Plan);
+  for(int Idx=0; Idx<Times; Idx++) Freq[Idx]=Hop.getFrequency(Time[Idx], Slot, OGN); }
@@ -0,0 +1,58 @@
+#ifndef __OGN_CODEC_H__
+#define __OGN_CODEC_H__
+
+// The tracker codecs as a host library for ground-station software: libogncodec.a/.so by "make host-lib".
+// Exactly the FEC, whitening and field encoding of the firmware, but on arrays of packets.
+// The API takes only plain types: ogn.h, ldpc.h and freqplan.h stay inside the library.
+// Packets are OGN_CodecBytes: 20 data bytes followed by 6 FEC bytes, as they go over the air.
+// Stride is the distance between packets, thus they can sit inside larger records of the caller.
+
+#include <stdint.h>
+
+const int     OGN_CodecVersion = 1;          // changes when the API changes incompatibly
+const int     OGN_CodecBytes   = 26;         // [bytes] data + FEC
+const int16_t OGN_NoBaro       = -32768;     // BaroAltDiff of packets without the barometric altitude
+
+struct OGN_CodecFields                       // one array per field, one element per packet: arrays left null are skipped
+{ uint8_t  *Check;                           // [ ] number of failed parity checks: 0 = correct packet
+  uint32_t *Address;                         // 24-bit
+  uint8_t  *AddrType;                        // 0 = random, 1 = ICAO, 2 = FLARM, 3 = OGN
+  uint8_t  *Other;                           // 1 = status/info packet: the position fields are not valid
+  uint8_t  *Relay;                           // number of times relayed
+  uint8_t  *Time;                            // [sec] second of the minute
+  uint8_t  *AcftType;                        // 1 = glider, 2 = towplane, 3 = helicopter, ...
+  uint8_t  *FixQuality;                      // 0 = none, 1 = GPS, 2 = differential GPS
+  uint8_t  *FixMode;                         // 0 = 2-D, 1 = 3-D
+  int32_t  *Latitude;                        // [1/600000 deg]
+  int32_t  *Longitude;                       // [1/600000 deg]
+  int32_t  *Altitude;                        // [m]
+  int16_t  *BaroAltDiff;                     // [m] barometric minus GPS altitude or OGN_NoBaro
+  float    *DOP;                             // [ ] 1.0 and up
+  float    *Speed;                           // [m/s]
+  float    *Heading;                         // [deg]
+  float    *ClimbRate;                       // [m/s]
+  float    *TurnRate;                        // [deg/s]
+} ;
+
+int  OGN_CheckFEC(uint8_t *Check, const uint8_t *Packet, int Packets, int Stride=OGN_CodecBytes); // returns the number of correct packets
+void OGN_Whiten  (uint8_t *Packet, int Packets, int Stride=OGN_CodecBytes);              // in place, only the data bytes
+void OGN_Dewhiten(uint8_t *Packet, int Packets, int Stride=OGN_CodecBytes);
+void OGN_Extract (const OGN_CodecFields &Fields, const uint8_t *Packet, int Packets, int Stride=OGN_CodecBytes); // de-whitened packets: all but Check
+int  OGN_Decode  (const OGN_CodecFields &Fields, const uint8_t *Packet, int Packets, int Stride=OGN_CodecBytes); // received packets: check, de-whiten, extract
+                                                                                         // returns the number of correct packets, fields of bad ones are filled as well
+void OGN_Encode  (uint8_t *Packet, const OGN_CodecFields &Fields, int Packets, int Stride=OGN_CodecBytes); // position packets ready to transmit: whitened, with FEC
+                                                                                         // Check and Other are not used, null fields are taken as zero
+
+struct OGN_CodecPlan                         // a frequency plan
+{ uint8_t  Plan;                             // 1 = Europe/Africa, 2 = USA/Canada, 3 = Australia/South America, 4 = New Zealand, 5 = Europe/Africa 434MHz
+  uint8_t  Channels;
+  uint32_t BaseFreq;                         // [Hz] channel #0
+  uint32_t ChanSepar;                        // [Hz] channel spacing
+  const char *Name; } ;
+
+uint8_t OGN_CalcPlan(int32_t Latitude, int32_t Longitude);                               // [1/600000 deg] the plan for a position
+bool    OGN_getPlan(OGN_CodecPlan &Plan, uint8_t Number);                                // false for an unknown plan number
+void    OGN_Channels   (uint8_t  *Channel, const uint32_t *Time, int Times, uint8_t Plan, uint8_t Slot, uint8_t OGN=1); // [UTC sec] hopping channels
+void    OGN_Frequencies(uint32_t *Freq,    const uint32_t *Time, int Times, uint8_t Plan, uint8_t Slot, uint8_t OGN=1); // [Hz]
+
+#endif // __OGN_CODEC_H__
@@ -0,0 +1,173 @@
+// g++ -std=gnu++14 -O2 -I. -o ogn_codec_bench ogn_codec_bench.cc ogn_codec.cpp ldpc.cpp bitcount.cpp
+// make host-bench : the same, linked to build/host/libogncodec.a
+
+// The host codec library (ogn_codec.h) against the firmware classes packet by packet: the FEC check, de-whitening,
+// the decoded fields and the frequency hopping must be the same, encoding the decoded fields must give back
+// the packets (the heading up to one code, as EncodeHeading() rounds down).
+// Then the throughput of every stage, in million packets per second.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <chrono>
+
+#include "ogn_codec.h"
+#include "ogn.h"
+#include "freqplan.h"
+
+static double Wall_Time(void)
+{ return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count(); }
+
+static void RandomPacket(OGN_TxPacket &Tx)                       // a position packet as the tracker sends it
+{ OGN_Packet &Pkt = Tx.Packet; Pkt.Clear();
+  Pkt.Header.Address    = rand()&0xFFFFFF;
+  Pkt.Header.AddrType   = rand()%4;
+  Pkt.Header.RelayCount = rand()%2;
+  Pkt.calcAddrParity();
+  Pkt.Position.Time       = rand()%60;
+  Pkt.Position.AcftType   = rand()%16;
+  Pkt.Position.FixQuality = 1+rand()%2;
+  Pkt.Position.FixMode    = rand()%2;
+  Pkt.EncodeLatitude (rand()%(180*600000)-90*600000);
+  Pkt.EncodeLongitude(rand()%(360*600000)-180*600000);
+  Pkt.EncodeAltitude(rand()%20000);
+  if(rand()%4) Pkt.setBaroAltDiff(rand()%511-255); else Pkt.clrBaro();
+  Pkt.EncodeDOP(rand()%256);
+  Pkt.EncodeSpeed(rand()%4000);
+  Pkt.EncodeHeading(rand()%3600);
+  Pkt.EncodeClimbRate(rand()%2000-1000);
+  Pkt.EncodeTurnRate(rand()%800-400);
+  Pkt.Whiten(); Tx.calcFEC(); }
+
+struct Columns                                                    // storage behind OGN_CodecFields
+{ uint8_t *Check, *AddrType, *Other, *Relay, *Time, *AcftType, *FixQuality, *FixMode;
+  uint32_t *Address; int32_t *Latitude, *Longitude, *Altitude; int16_t *BaroAltDiff;
+  float *DOP, *Speed, *Heading, *ClimbRate, *TurnRate;
+
+  void Alloc(int Size, OGN_CodecFields &F)
+  { F.Check=Check=new uint8_t[Size]; F.AddrType=AddrType=new uint8_t[Size]; F.Other=Other=new uint8_t[Size];
+    F.Relay=Relay=new uint8_t[Size]; F.Time=Time=new uint8_t[Size]; F.AcftType=AcftType=new uint8_t[Size];
+    F.FixQuality=FixQuality=new uint8_t[Size]; F.FixMode=FixMode=new uint8_t[Size];
+    F.Address=Address=new uint32_t[Size]; F.Latitude=Latitude=new int32_t[Size]; F.Longitude=Longitude=new int32_t[Size];
+    F.Altitude=Altitude=new int32_t[Size]; F.BaroAltDiff=BaroAltDiff=new int16_t[Size];
+    F.DOP=DOP=new float[Size]; F.Speed=Speed=new float[Size]; F.Heading=Heading=new float[Size];
+    F.ClimbRate=ClimbRate=new float[Size]; F.TurnRate=TurnRate=new float[Size]; }
+} ;
+
+static int Compare(const OGN_CodecFields &F, int Idx, const OGN_TxPacket &Ref, uint8_t Check) // fields against the firmware decode
+{ const OGN_Packet &Pkt = Ref.Packet;
+  int16_t AltDiff = Pkt.hasBaro() ? Pkt.getBaroAltDiff() : OGN_NoBaro;
+  return F.Check[Idx]!=Check || F.Address[Idx]!=Pkt.Header.Address || F.AddrType[Idx]!=Pkt.Header.AddrType
+      || F.Other[Idx]!=Pkt.Header.Other || F.Relay[Idx]!=Pkt.Header.RelayCount
+      || F.Time[Idx]!=Pkt.Position.Time || F.AcftType[Idx]!=Pkt.Position.AcftType
+      || F.FixQuality[Idx]!=Pkt.Position.FixQuality || F.FixMode[Idx]!=Pkt.Position.FixMode
+      || F.Latitude[Idx]!=Pkt.DecodeLatitude() || F.Longitude[Idx]!=Pkt.DecodeLongitude()
+      || F.Altitude[Idx]!=Pkt.DecodeAltitude() || F.BaroAltDiff[Idx]!=AltDiff
+      || F.DOP[Idx]!=0.1f*(10+Pkt.DecodeDOP()) || F.Speed[Idx]!=0.1f*Pkt.DecodeSpeed()
+      || F.Heading[Idx]!=0.1f*Pkt.DecodeHeading() || F.ClimbRate[Idx]!=0.1f*Pkt.DecodeClimbRate()
+      || F.TurnRate[Idx]!=0.1f*Pkt.DecodeTurnRate(); }
+
+static int CheckFreqPlans(void)                                   // hopping against FreqPlan
+{ const int Times=2000; uint32_t Time[Times]; uint32_t Freq[Times]; uint8_t Chan[Times];
+  for(int Idx=0; Idx<Times; Idx++) Time[Idx]=1500000000+Idx*7919;
+  int Err=0;
+  for(uint8_t Plan=0; Plan<=5; Plan++)
+  { OGN_CodecPlan Info; if(!OGN_getPlan(Info, Plan)) Err++;
+    FreqPlan Ref; Ref.setPlan(Plan);
+    if(Info.Channels!=Ref.Channels || Info.BaseFreq!=Ref.BaseFreq || Info.ChanSepar!=Ref.ChanSepar) Err++;
+    for(uint8_t Slot=0; Slot<2; Slot++)
+     for(uint8_t OGN=0; OGN<2; OGN++)
+     { OGN_Frequencies(Freq, Time, Times, Plan, Slot, OGN);
+       OGN_Channels(Chan, Time, Times, Plan, Slot, OGN);
+       for(int Idx=0; Idx<Times; Idx++)
+         if(Freq[Idx]!=Ref.getFrequency(Time[Idx], Slot, OGN) || Chan[Idx]!=Ref.getChannel(Time[Idx], Slot, OGN)) Err++; }
+  }
+  OGN_CodecPlan Info; if(OGN_getPlan(Info, 6)) Err++;
+  if(OGN_CalcPlan(47*600000, 19*600000)!=1 || OGN_CalcPlan(40*600000, -100*600000)!=2) Err++;
+  return Err; }
+
+int main(int argc, char *argv[])
+{ int Packets = argc>1 ? atoi(argv[1]):100000;
+  const int Reps=5;
+  srand(1);
+  uint8_t *Air = new uint8_t[Packets*OGN_CodecBytes];             // as received: whitened, with FEC, some with bit errors
+  OGN_TxPacket *Ref = new OGN_TxPacket[Packets];
+  uint8_t *RefCheck = new uint8_t[Packets];
+  for(int Idx=0; Idx<Packets; Idx++)
+  { OGN_TxPacket Tx; RandomPacket(Tx);
+    if(rand()%8==0)
+    { int Flips=1+rand()%3;
+      for(int Flip=0; Flip<Flips; Flip++) { int Bit=rand()%208; Tx.Byte()[Bit>>3]^=1<<(Bit&7); } }
+    memcpy(Air+Idx*OGN_CodecBytes, Tx.Byte(), OGN_CodecBytes);
+    RefCheck[Idx]=Tx.checkFEC();                                   // the firmware path, packet by packet
+    Tx.Packet.Dewhiten(); Ref[Idx]=Tx; }
+
+  OGN_CodecFields Fields; Columns Cols; Cols.Alloc(Packets, Fields);
+  int Errors=0;
+  int Good=OGN_Decode(Fields, Air, Packets);
+  int RefGood=0;
+  for(int Idx=0; Idx<Packets; Idx++)
+  { RefGood+=(RefCheck[Idx]==0);
+    Errors+=Compare(Fields, Idx, Ref[Idx], RefCheck[Idx]); }
+  if(Good!=RefGood) Errors++;
+  printf("decode: %d packets, %d correct, %d errors against the firmware\n", Packets, Good, Errors);
+
+  uint8_t *Again = new uint8_t[Packets*OGN_CodecBytes];          // encode the decoded fields: the correct packets come back
+  OGN_Encode(Again, Fields, Packets);                             // but the heading: EncodeHeading() of the 0.1deg value
+  int Differ=0;                                                   // can be one code below the original
+  if(OGN_CheckFEC(0, Again, Packets)!=Packets) Differ++;
+  for(int Idx=0; Idx<Packets; Idx++)
+  { if(RefCheck[Idx]) continue;
+    OGN_TxPacket Tx; memcpy(Tx.Byte(), Again+Idx*OGN_CodecBytes, OGN_CodecBytes); Tx.Packet.Dewhiten();
+    int Heading=Tx.Packet.Position.Heading; int RefHeading=Ref[Idx].Packet.Position.Heading;
+    if(Heading!=RefHeading && Heading!=((RefHeading-1)&0x3FF)) Differ++;
+    Tx.Packet.Position.Heading=RefHeading;
+    if(memcmp(Tx.Packet.Byte(), Ref[Idx].Packet.Byte(), OGN_Packet::Bytes)) Differ++; }
+  printf("encode: %d correct packets differ after decode+encode\n", Differ);
+  Errors+=Differ;
+
+  int Stride=32; uint8_t *Rec = new uint8_t[Packets*Stride];     // packets inside larger records
+  for(int Idx=0; Idx<Packets; Idx++) memcpy(Rec+Idx*Stride, Air+Idx*OGN_CodecBytes, OGN_CodecBytes);
+  OGN_Dewhiten(Rec, Packets, Stride);
+  for(int Idx=0; Idx<Packets; Idx++)
+    if(memcmp(Rec+Idx*Stride, Ref[Idx].Byte(), OGN_Packet::Bytes)) Errors++;
+
+  int PlanErr=CheckFreqPlans();
+  printf("frequency plans: %d errors\n", PlanErr);
+  Errors+=PlanErr;
+
+  double Time[7]; for(int Stage=0; Stage<7; Stage++) Time[Stage]=1e9;
+  uint8_t *Work = new uint8_t[Packets*OGN_CodecBytes];
+  uint32_t *UTC = new uint32_t[Packets]; uint32_t *Freq = new uint32_t[Packets];
+  for(int Idx=0; Idx<Packets; Idx++) UTC[Idx]=1500000000+Idx;
+  uint32_t Sum=0;
+  for(int Rep=0; Rep<Reps; Rep++)
+  { double Start=Wall_Time();
+    for(int Idx=0; Idx<Packets; Idx++)                            // the firmware way: one packet at a time
+    { OGN_TxPacket Tx; memcpy(Tx.Byte(), Air+Idx*OGN_CodecBytes, OGN_CodecBytes);
+      if(Tx.checkFEC()) continue;
+      Tx.Packet.Dewhiten();
+      Sum+=Tx.Packet.DecodeLatitude()+Tx.Packet.DecodeAltitude()+Tx.Packet.DecodeSpeed(); }
+    double Stop=Wall_Time(); if(Stop-Start<Time[0]) Time[0]=Stop-Start;
+    Start=Wall_Time(); OGN_CheckFEC(Cols.Check, Air, Packets);
+    Stop=Wall_Time(); if(Stop-Start<Time[1]) Time[1]=Stop-Start;
+    memcpy(Work, Air, Packets*OGN_CodecBytes);
+    Start=Wall_Time(); OGN_Dewhiten(Work, Packets);
+    Stop=Wall_Time(); if(Stop-Start<Time[2]) Time[2]=Stop-Start;
+    Start=Wall_Time(); OGN_Extract(Fields, Work, Packets);
+    Stop=Wall_Time(); if(Stop-Start<Time[3]) Time[3]=Stop-Start;
+    Start=Wall_Time(); OGN_Decode(Fields, Air, Packets);
+    Stop=Wall_Time(); if(Stop-Start<Time[4]) Time[4]=Stop-Start;
+    Start=Wall_Time(); OGN_Encode(Work, Fields, Packets);
+    Stop=Wall_Time(); if(Stop-Start<Time[5]) Time[5]=Stop-Start;
+    Start=Wall_Time(); OGN_Frequencies(Freq, UTC, Packets, 2, 1);
+    Stop=Wall_Time(); if(Stop-Start<Time[6]) Time[6]=Stop-Start;
+    Sum+=Freq[Rep]; }
+  const char *Name[7] = { "per packet (firmware)", "CheckFEC", "Dewhiten", "Extract", "Decode", "Encode", "Frequencies" } ;
+  for(int Stage=0; Stage<7; Stage++)
+    printf("%-22s %7.2f Mpkt/s\n", Name[Stage], 1e-6*Packets/Time[Stage]);
+  printf("(%08X)\n", Sum);
+
+  return Errors ? 1:0; }
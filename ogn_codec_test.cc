@@ -0,0 +1,180 @@
+// g++ -std=gnu++14 -O2 -I. -o ogn_codec_test ogn_codec_test.cc
+// arm-none-eabi-g++ -O2 -mcpu=cortex-m3 -mthumb -I. ... : the same source gives DWT cycle counts on the Cortex-M3
+// g++ -O2 -march=native -I. ... : with LZCNT on the host
+
+// The variable resolution codecs of OGN_Packet against the former comparison-chain versions (kept here as the reference):
+// exhaustive over the full input range of every function, then the time per call of both versions on random valid field values.
+// The CLZ versions (OGN_Packet::VarResCLZ) are checked and timed on any host, the packet codecs are checked as well:
+// they are the CLZ versions only with a count-leading-zeros instruction, else the comparison chains.
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "ogn.h"
+
+// ----------------------------------------------------------------------------------------------------------------
+// the former versions from ogn.h
+
+static uint16_t Ref_EncodeUR2V8(uint16_t Value)                                 // Encode unsigned 12bit (0..3832) as 10bit
+{      if(Value<0x100) { }
+  else if(Value<0x300) Value = 0x100 | ((Value-0x100)>>1);
+  else if(Value<0x700) Value = 0x200 | ((Value-0x300)>>2);
+  else if(Value<0xF00) Value = 0x300 | ((Value-0x700)>>3);
+  else                 Value = 0x3FF;
+  return Value; }
+
+static uint16_t Ref_DecodeUR2V8(uint16_t Value)                                 // Decode 10bit 0..0x3FF
+{ uint16_t  Range = Value>>8;
+  Value &= 0x0FF;
+  if(Range==0) return Value;              // 000..0FF
+  if(Range==1) return 0x101+(Value<<1);   // 100..2FE
+  if(Range==2) return 0x302+(Value<<2);   // 300..6FC
+  return 0x704+(Value<<3); } // 700..EF8                       // in 12bit (0..3832)
+
+static uint8_t Ref_EncodeUR2V5(uint16_t Value)                                  // Encode unsigned 9bit (0..472) as 7bit
+{      if(Value<0x020) { }
+  else if(Value<0x060) Value = 0x020 | ((Value-0x020)>>1);
+  else if(Value<0x0E0) Value = 0x040 | ((Value-0x060)>>2);
+  else if(Value<0x1E0) Value = 0x060 | ((Value-0x0E0)>>3);
+  else                 Value = 0x07F;
+  return Value; }
+
+static uint16_t Ref_DecodeUR2V5(uint16_t Value)                                 // Decode 7bit as unsigned 9bit (0..472)
+{ uint8_t Range = (Value>>5)&0x03;
+          Value &= 0x1F;
+       if(Range==0) { }                            // 000..01F
+  else if(Range==1) { Value = 0x021+(Value<<1); }  // 020..05E
+  else if(Range==2) { Value = 0x062+(Value<<2); }  // 060..0DC
+  else              { Value = 0x0E4+(Value<<3); }  // 0E0..1D8 => max. Value = 472
+  return Value; }
+
+static uint8_t Ref_EncodeSR2V5(int16_t Value)                                  // Encode signed 10bit (-472..+472) as 8bit
+{ uint8_t Sign=0; if(Value<0) { Value=(-Value); Sign=0x80; }
+  Value = Ref_EncodeUR2V5(Value);
+  return Value | Sign; }
+
+static int16_t Ref_DecodeSR2V5( int16_t Value)                                // Decode
+{ int16_t Sign =  Value&0x80;
+  Value = Ref_DecodeUR2V5(Value&0x7F);
+  return Sign ? -Value: Value; }
+
+static uint16_t Ref_EncodeUR2V6(uint16_t Value)                                // Encode unsigned 10bit (0..952) as 8 bit
+{      if(Value<0x040) { }
+  else if(Value<0x0C0) Value = 0x040 | ((Value-0x040)>>1);
+  else if(Value<0x1C0) Value = 0x080 | ((Value-0x0C0)>>2);
+  else if(Value<0x3C0) Value = 0x0C0 | ((Value-0x1C0)>>3);
+  else                 Value = 0x0FF;
+  return Value; }
+
+static uint16_t Ref_DecodeUR2V6(uint16_t Value)                                // Decode 8bit as unsigned 10bit (0..952)
+{ uint16_t Range  = (Value>>6)&0x03;
+          Value &= 0x3F;
+       if(Range==0) { }                            // 000..03F
+  else if(Range==1) { Value = 0x041+(Value<<1); }  // 040..0BE
+  else if(Range==2) { Value = 0x0C2+(Value<<2); }  // 0C0..1BC
+  else              { Value = 0x1C4+(Value<<3); }  // 1C0..3B8 => max. Value = 952
+  return Value; }
+
+static uint16_t Ref_EncodeSR2V6(int16_t Value)                                 // Encode signed 11bit (-952..+952) as 9bit
+{ uint16_t Sign=0; if(Value<0) { Value=(-Value); Sign=0x100; }
+  Value = Ref_EncodeUR2V6(Value);
+  return Value | Sign; }
+
+static int16_t Ref_DecodeSR2V6( int16_t Value)                                // Decode 9bit as signed 11bit (-952..+952)
+{ int16_t Sign =  Value&0x100;
+  Value = Ref_DecodeUR2V6(Value&0x00FF);
+  return Sign ? -Value: Value; }
+
+
+static uint16_t Ref_EncodeUR2V12(uint16_t Value)                        // encode unsigned 16-bit (0..61432) as 14-bit
+{      if(Value<0x1000) { }
+  else if(Value<0x3000) Value = 0x1000 | ((Value-0x1000)>>1);
+  else if(Value<0x7000) Value = 0x2000 | ((Value-0x3000)>>2);
+  else if(Value<0xF000) Value = 0x3000 | ((Value-0x7000)>>3);
+  else                  Value = 0x3FFF;
+  return Value; }
+
+static uint16_t Ref_DecodeUR2V12(uint16_t Value)
+{ uint16_t Range = Value>>12;
+           Value &=0x0FFF;
+  if(Range==0) return         Value;       // 0000..0FFF
+  if(Range==1) return 0x1001+(Value<<1);   // 1000..2FFE
+  if(Range==2) return 0x3002+(Value<<2);   // 3000..6FFC
+  return 0x7004+(Value<<3); } // 7000..EFF8 => max: 61432
+
+// ----------------------------------------------------------------------------------------------------------------
+
+#ifdef __arm__
+static volatile uint32_t * const DEMCR      = (volatile uint32_t *)0xE000EDFC;
+static volatile uint32_t * const DWT_CTRL   = (volatile uint32_t *)0xE0001000;
+static volatile uint32_t * const DWT_CYCCNT = (volatile uint32_t *)0xE0001004;
+static void     Timer_Init(void)  { *DEMCR |= 0x01000000; *DWT_CYCCNT=0; *DWT_CTRL |= 1; }
+static uint32_t Timer_Ticks(void) { return *DWT_CYCCNT; }
+static const char *TimerUnit = "CPU cycles";
+static const double TimerScale = 1.0;
+#else
+#include <chrono>
+static void     Timer_Init(void)  { }
+static uint64_t Timer_Ticks(void) { return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count(); }
+static const char *TimerUnit = "ns";
+static const double TimerScale = 1.0;
+#endif
+
+static volatile uint32_t Sink;                          // keeps the compiler from removing the loops
+
+const int Samples = 1024;                               // the timing runs on random values: as the fields of real packets
+static int32_t Sample[Samples];
+
+template <class Func>
+ static double Time(Func F, int32_t First, int32_t Last, int Loops) // [TimerUnit] per call
+{ uint32_t Random=12345;
+  for(int Idx=0; Idx<Samples; Idx++)
+  { Random = Random*1103515245+12345; Sample[Idx] = First + (int32_t)((Random>>8)%(uint32_t)(Last-First+1)); }
+  uint32_t Sum=0;
+  uint64_t Start=Timer_Ticks();
+  for(int Loop=0; Loop<Loops; Loop++)
+    for(int Idx=0; Idx<Samples; Idx++) Sum+=F(Sample[Idx]);
+  uint64_t Ticks=(uint32_t)(Timer_Ticks()-Start);
+  Sink=Sum;
+  return TimerScale*Ticks/((double)Loops*Samples); }
+
+template <class New, class Api, class Ref>
+ static int Check(const char *Name, New N, Api A, Ref R, int32_t First, int32_t Last, int32_t Min, int32_t Max) // exhaustive comparison,
+                                                                                                            // then the timing over Min..Max
+{ int Errors=0;
+  for(int32_t Value=First; Value<=Last; Value++)
+  { if(N(Value)!=R(Value))
+    { if(Errors<4) printf("%s(%d): CLZ %d instead of %d\n", Name, (int)Value, (int)N(Value), (int)R(Value));
+      Errors++; }
+    if(A(Value)!=R(Value))
+    { if(Errors<4) printf("%s(%d): packet codec %d instead of %d\n", Name, (int)Value, (int)A(Value), (int)R(Value));
+      Errors++; }
+  }
+  int Loops = 256;
+  double RefTime=Time(R, Min, Max, Loops);
+  double NewTime=Time(N, Min, Max, Loops);
+  printf("%-13s %6d values, %d errors: chains %6.2f => CLZ %6.2f %s/call\n", Name, (int)(Last-First+1), Errors, RefTime, NewTime, TimerUnit);
+  return Errors; }
+
+#define CHECK(Func, Type, First, Last, Min, Max) \
+  Check(#Func, [](int32_t Value) { return (int32_t)OGN_Packet::VarResCLZ::Func((Type)Value); }, \
+               [](int32_t Value) { return (int32_t)OGN_Packet::Func((Type)Value); }, \
+               [](int32_t Value) { return (int32_t)Ref_##Func((Type)Value); }, First, Last, Min, Max)
+
+int main(int argc, char *argv[])
+{ Timer_Init();
+  printf("The packet codecs use the %s versions\n", OGN_Packet::VarResWithCLZ ? "CLZ":"comparison-chain");
+  int Errors=0;
+  Errors+=CHECK(EncodeUR2V8,  uint16_t,      0, 0xFFFF, 0, 3832);
+  Errors+=CHECK(DecodeUR2V8,  uint16_t,      0, 0xFFFF, 0, 0x3FF);
+  Errors+=CHECK(EncodeUR2V5,  uint16_t,      0, 0xFFFF, 0, 472);
+  Errors+=CHECK(DecodeUR2V5,  uint16_t,      0, 0xFFFF, 0, 0x7F);
+  Errors+=CHECK(EncodeSR2V5,   int16_t, -32768, 32767, -472, 472);
+  Errors+=CHECK(DecodeSR2V5,   int16_t, -32768, 32767, 0, 0xFF);
+  Errors+=CHECK(EncodeUR2V6,  uint16_t,      0, 0xFFFF, 0, 952);
+  Errors+=CHECK(DecodeUR2V6,  uint16_t,      0, 0xFFFF, 0, 0xFF);
+  Errors+=CHECK(EncodeSR2V6,   int16_t, -32768, 32767, -952, 952);
+  Errors+=CHECK(DecodeSR2V6,   int16_t, -32768, 32767, 0, 0x1FF);
+  Errors+=CHECK(EncodeUR2V12, uint16_t,      0, 0xFFFF, 0, 61432);
+  Errors+=CHECK(DecodeUR2V12, uint16_t,      0, 0xFFFF, 0, 0x3FFF);
+  return Errors ? 1:0; }
@@ -0,0 +1,68 @@
+// g++ -std=gnu++14 -O2 -I. -o ogn_tea_test ogn_tea_test.cc
+// g++ -O3 -march=native -I. ... : with AVX2 on the host
+
+// Batched whitening OGN_Packet::Whiten(Packet, Packets) and de-whitening against the one-packet-at-a-time Whiten()/Dewhiten():
+// bit-exact for every batch length (including the remainders) and the throughput of both.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <chrono>
+
+#include "ogn.h"
+
+static double Wall_Time(void)
+{ return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count(); }
+
+static void Random(OGN_Packet *Packet, int Packets)
+{ for(int Idx=0; Idx<Packets; Idx++)
+  { Packet[Idx].HeaderWord=rand();
+    for(int Word=0; Word<4; Word++) Packet[Idx].Data[Word] = ((uint32_t)rand()<<16) ^ rand(); }
+}
+
+static int Check(int Packets)                          // batch against single for this many packets
+{ OGN_Packet *Ref = new OGN_Packet[Packets];
+  OGN_Packet *Bat = new OGN_Packet[Packets];
+  OGN_RxPacket *Rx = new OGN_RxPacket[Packets];
+  OGN_TxPacket *Tx = new OGN_TxPacket[Packets];
+  Random(Ref, Packets);
+  for(int Idx=0; Idx<Packets; Idx++) { Bat[Idx]=Ref[Idx]; Rx[Idx].Packet=Ref[Idx]; Tx[Idx].Packet=Ref[Idx]; }
+  int Err=0;
+  for(int Idx=0; Idx<Packets; Idx++) Ref[Idx].Whiten();
+  OGN_Packet::Whiten(Bat, Packets); OGN_TxPacket::Whiten(Tx, Packets);
+  for(int Idx=0; Idx<Packets; Idx++)
+  { if(memcmp(&Ref[Idx], &Bat[Idx], sizeof(OGN_Packet))) Err++;
+    if(memcmp(&Ref[Idx], &Tx[Idx].Packet, sizeof(OGN_Packet))) Err++; }
+  for(int Idx=0; Idx<Packets; Idx++) { Rx[Idx].Packet=Ref[Idx]; Ref[Idx].Dewhiten(); }
+  OGN_Packet::Dewhiten(Bat, Packets); OGN_RxPacket::Dewhiten(Rx, Packets);
+  for(int Idx=0; Idx<Packets; Idx++)
+  { if(memcmp(&Ref[Idx], &Bat[Idx], sizeof(OGN_Packet))) Err++;
+    if(memcmp(&Ref[Idx], &Rx[Idx].Packet, sizeof(OGN_Packet))) Err++; }
+  delete [] Ref; delete [] Bat; delete [] Rx; delete [] Tx;
+  return Err; }
+
+int main(int argc, char *argv[])
+{ int Errors=0;
+  for(int Packets=0; Packets<=64; Packets++) Errors+=Check(Packets);
+  Errors+=Check(1000);
+  printf("%d lanes: %d errors against Whiten()/Dewhiten()\n", OGN_Packet::TEA_Lanes, Errors);
+
+  const int Packets=4096; const int Loops=500;
+  OGN_Packet *Packet = new OGN_Packet[Packets];
+  Random(Packet, Packets);
+  double Start=Wall_Time();
+  for(int Loop=0; Loop<Loops; Loop++)
+  { for(int Idx=0; Idx<Packets; Idx++) Packet[Idx].Whiten();
+    for(int Idx=0; Idx<Packets; Idx++) Packet[Idx].Dewhiten(); }
+  double Single=Wall_Time()-Start;
+  Start=Wall_Time();
+  for(int Loop=0; Loop<Loops; Loop++)
+  { OGN_Packet::Whiten(Packet, Packets); OGN_Packet::Dewhiten(Packet, Packets); }
+  double Batch=Wall_Time()-Start;
+  double Count=2.0*Packets*Loops;
+  printf("single: %6.2f Mpackets/sec\n", Count/Single*1e-6);
+  printf("batch : %6.2f Mpackets/sec (x%4.2f)\n", Count/Batch*1e-6, Single/Batch);
+  delete [] Packet;
+  return Errors ? 1:0; }
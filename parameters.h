@@ -47,6 +47,7 @@ class FlashParameters
      { bool SaveToFlash:1;   // Save parameters from the config file to Flash
        bool       hasBT:1;   // has BT interface on the console
        bool       BT_ON:1;   // BT on after power up
+       bool      BinOut:1;   // received packets as binary frames instead of $POGNT/$PFLAA (WITH_BINOUT)
      } ;
    } ;                       //
     int8_t  TimeCorr;        // [sec] it appears for ArduPilot you need to correct time by 3 seconds
@@ -136,6 +137,7 @@ class FlashParameters
 
     FreqPlan       =         0; // [0..5]
     PPSdelay       =       100; // [ms]
+    BinOut         =         0; // text output: $POGNT/$PFLAA
 
     for(uint8_t Idx=0; Idx<InfoParmNum; Idx++)
       InfoParmValue(Idx)[0] = 0;
@@ -318,6 +320,9 @@ class FlashParameters
     if(strcmp(Name, "TimeCorr")==0)
     { int32_t Corr=0; if(Read_Int(Corr, Value)<=0) return 0;
       TimeCorr=Corr; return 1; }
+    if(strcmp(Name, "BinOut")==0)
+    { uint32_t Bin=0; if(Read_Int(Bin, Value)<=0) return 0;
+      BinOut=Bin; return 1; }
     if(strcmp(Name, "GeoidSepar")==0)
     { return Read_Float1(GeoidSepar, Value)<=0; }
     for(uint8_t Idx=0; Idx<InfoParmNum; Idx++)
@@ -410,6 +415,7 @@ class FlashParameters
     Write_SignDec(Line, "TimeCorr"  , (int32_t)TimeCorr         ); strcat(Line, " #  [    s]\n"); if(fputs(Line, File)==EOF) return EOF;
     Write_Float1 (Line, "GeoidSepar",          GeoidSepar       ); strcat(Line, " #  [    m]\n"); if(fputs(Line, File)==EOF) return EOF;
     Write_UnsDec (Line, "PPSdelay"  ,(uint32_t)PPSdelay         ); strcat(Line, " #  [   ms]\n"); if(fputs(Line, File)==EOF) return EOF;
+    Write_UnsDec (Line, "BinOut"    ,(uint32_t)BinOut           ); strcat(Line, " #  [ bool]\n"); if(fputs(Line, File)==EOF) return EOF;
     for(uint8_t Idx=0; Idx<InfoParmNum; Idx++)
     { Write_String (Line, InfoParmName(Idx), InfoParmValue(Idx)); strcat(Line, " #  [char]\n"); if(fputs(Line, File)==EOF) return EOF; }
 #ifdef WITH_WIFI
@@ -442,6 +448,7 @@ class FlashParameters
     Write_SignDec(Line, "TimeCorr"  , (int32_t)TimeCorr         ); strcat(Line, " #  [    s]\n"); Format_String(Output, Line);
     Write_Float1 (Line, "GeoidSepar",          GeoidSepar       ); strcat(Line, " #  [    m]\n"); Format_String(Output, Line);
     Write_UnsDec (Line, "PPSdelay"  ,(uint32_t)PPSdelay         ); strcat(Line, " #  [   ms]\n"); Format_String(Output, Line);
+    Write_UnsDec (Line, "BinOut"    ,(uint32_t)BinOut           ); strcat(Line, " #  [ bool]\n"); Format_String(Output, Line);
     for(uint8_t Idx=0; Idx<InfoParmNum; Idx++)
     { Write_String (Line, InfoParmName(Idx), InfoParmValue(Idx)); strcat(Line, " #  [char]\n"); Format_String(Output, Line); }
 #ifdef WITH_WIFI
@@ -0,0 +1,76 @@
+// g++ -std=gnu++14 -O2 -I. -DWITH_PPM -o ppm_test ppm_test.cc ldpc.cpp bitcount.cpp
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "ldpc.h"
+#include "ldpc_channel.h"
+
+typedef OGN_PPM_Decoder<float>   FloatDecoder;
+typedef OGN_PPM_Decoder<int16_t> FixedDecoder;
+
+static void MakePacket(uint32_t Code[12])                     // random user data encoded into 354 bits
+{ for(int Idx=0; Idx<5; Idx++) Code[Idx] = rand() ^ (rand()<<16);
+  LDPC_Encode_n354k160(Code); }
+
+static int getBit(const uint32_t *Code, int Bit) { return (Code[Bit>>5]>>(Bit&31))&1; }
+
+static void MakePulses(float Power[FloatDecoder::CodeSymbols][FloatDecoder::PulsesPerSlot], const uint32_t *Code, float Ampl)
+{ for(int Symb=0; Symb<FloatDecoder::CodeSymbols; Symb++)      // same bit to symbol mapping as OGN_PPM_Decoder::Process()
+  { int Bin=0;
+    for(int Bit=FloatDecoder::BitsPerSymbol-1; Bit>=0; Bit--)
+      Bin = (Bin<<1) | getBit(Code, Symb+Bit*FloatDecoder::CodeSymbols);
+    int TxPulse = FloatDecoder::Gray(Bin);
+    for(int Pulse=0; Pulse<FloatDecoder::PulsesPerSlot; Pulse++)
+    { double I=LDPC_Channel::Gauss()*M_SQRT1_2, Q=LDPC_Channel::Gauss()*M_SQRT1_2;  // unit noise power on every pulse position
+      if(Pulse==TxPulse) I+=Ampl;
+      Power[Symb][Pulse] = I*I+Q*Q; }
+  }
+}
+
+static double CPU_Time(void) { return (double)clock()/CLOCKS_PER_SEC; }
+
+int main(int argc, char *argv[])
+{ srand(argc>1 ? atoi(argv[1]):1);
+  const int Packets=200;
+  static FloatDecoder Float;
+  static FixedDecoder Fixed;
+  static float Power[FloatDecoder::CodeSymbols][FloatDecoder::PulsesPerSlot];
+  typedef LDPC_Arith<int16_t> Fix;
+  int16_t Prob[4] = { 0, 1000, 0, 0 };                              // all the probability on one pulse: 32768 must saturate
+  Fix::Normalize(Prob, 4, Fix::One());
+  bool SatOK = Prob[1]==32767 && Fix::Uniform(1)==32767;
+  printf("LDPC_Arith<int16_t>: Normalize() of a single pulse = %d, Uniform(1) = %d\n", Prob[1], Fix::Uniform(1));
+  printf("SNR[dB]  Float: FER  ms/pkt  Fixed: FER  ms/pkt\n");
+  for(float SNR=6.0; SNR<=14.01; SNR+=1.0)
+  { float Ampl = pow(10.0, SNR/20);
+    int FloatErr=0, FixedErr=0; double FloatTime=0, FixedTime=0;
+    for(int Pkt=0; Pkt<Packets; Pkt++)
+    { uint32_t Code[12]; MakePacket(Code);
+      MakePulses(Power, Code, Ampl);
+      Float.Clear(); Fixed.Clear();
+      for(int Symb=0; Symb<FloatDecoder::CodeSymbols; Symb++)
+      { for(int Pulse=0; Pulse<FloatDecoder::PulsesPerSlot; Pulse++)
+        { Float.addSymbol(Symb, Pulse, Power[Symb][Pulse]);
+          int Q8 = floor(Power[Symb][Pulse]*256+0.5); if(Q8>32767) Q8=32767;
+          Fixed.addSymbol(Symb, Pulse, Q8); }
+      }
+      uint32_t Out[12];
+      double Start=CPU_Time();
+      Float.Process();
+      FloatTime+=CPU_Time()-Start;
+      Float.LDPC_Decoder.Output(Out);
+      if(memcmp(Out, Code, 5*4)) FloatErr++;
+      Start=CPU_Time();
+      Fixed.Process();
+      FixedTime+=CPU_Time()-Start;
+      Fixed.LDPC_Decoder.Output(Out);
+      if(memcmp(Out, Code, 5*4)) FixedErr++; }
+    printf("%5.1f     %10.3f %7.3f %11.3f %7.3f\n", SNR,
+           (double)FloatErr/Packets, 1e3*FloatTime/Packets, (double)FixedErr/Packets, 1e3*FixedTime/Packets);
+  }
+  return SatOK?0:1; }
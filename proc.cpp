@@ -13,9 +13,21 @@
 #include "flashlog.h"
 #endif
 
+#ifdef WITH_RX_SCHED
+#include "rxsched.h"
+#endif
+
 static char           Line[128];      // for printing out to serial port, etc.
 
-static LDPC_Decoder     Decoder;      // error corrector for the OGN Gallager code
+static RFM_RxDecoder    Decoder;      // error corrector for the OGN Gallager code
+
+#ifdef WITH_RX_SCHED
+static RX_DecodeSched   RxSched;      // decode order and iteration budget for the received packets
+#endif
+
+#ifdef WITH_RX_COMBINE
+static RFM_RxPktCache<4> RxCache;     // copies which failed to decode: duplicate receptions are soft-combined
+#endif
 
 // #define DEBUG_PRINT
 
@@ -54,6 +66,21 @@ static void CleanRelayQueue(uint32_t Time, uint32_t Delay=20) // remove "old" pa
 
 // ---------------------------------------------------------------------------------------------------------------------------------------
 
+static void SendNMEA(const NMEA_Builder &NMEA, bool Log=1)     // a finished sentence to the console and (optionally) to the log file
+{ if(NMEA.Len==0) return;                                      // dropped on overflow
+  Format_BlockSink Cons(CONS_UART_WriteBlock);
+  xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
+  NMEA.Send(Cons);
+  xSemaphoreGive(CONS_Mutex);
+#ifdef WITH_SDLOG
+  if(Log && Log_Free()>=128)
+  { Format_BlockSink LogFile(Log_WriteBlock);
+    xSemaphoreTake(Log_Mutex, portMAX_DELAY);
+    NMEA.Send(LogFile);
+    xSemaphoreGive(Log_Mutex); }
+#endif
+}
+
 static void ReadStatus(OGN_TxPacket &StatPacket)                            // read the device status and fill the status packet
 {
 
@@ -72,64 +99,84 @@ static void ReadStatus(OGN_TxPacket &StatPacket)                            // r
   uint8_t RxRateLog2=0; RxRate>>=1; while(RxRate) { RxRate>>=1; RxRateLog2++; }
   StatPacket.Packet.Status.RxRate = RxRateLog2;
                                                                              // produce the POGNR sentence
-  { uint8_t Len=0;
-    Len+=Format_String(Line+Len, "$POGNR,");                                 // NMEA report: radio status
-    Len+=Format_UnsDec(Line+Len, RF_FreqPlan.Plan);                          // which frequency plan
-    Line[Len++]=',';
-    Len+=Format_UnsDec(Line+Len, RX_OGN_Count64);                            // number of OGN packets received
-    Line[Len++]=',';
-    Line[Len++]=',';
-    Len+=Format_SignDec(Line+Len, -5*RX_AverRSSI, 2, 1);                     // average RF level (over all channels)
-    Line[Len++]=',';
-    Len+=Format_UnsDec(Line+Len, (uint16_t)TX_Credit);
-    Line[Len++]=',';
-    Len+=Format_SignDec(Line+Len, (int16_t)RF_Temp);                         // the temperature of the RF chip
-    Line[Len++]=',';
-    // Len+=Format_SignDec(Line+Len, MCU_Temp, 2, 1);
-    Line[Len++]=',';
-    // Len+=Format_UnsDec(Line+Len, (MCU_VCC+5)/10, 3, 2);
-
-    Len+=NMEA_AppendCheckCRNL(Line, Len);                                    // append NMEA check-sum and CR+NL
-    // LogLine(Line);
-    // if(CONS_UART_Free()>=128)
-    { xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
-      Format_String(CONS_UART_Write, Line, 0, Len);                               // send the NMEA out to the console
-      xSemaphoreGive(CONS_Mutex); }
-#ifdef WITH_SDLOG
-    if(Log_Free()>=128)
-    { xSemaphoreTake(Log_Mutex, portMAX_DELAY);
-      Format_String(Log_Write, Line, Len, 0);                                     // send the NMEA out to the log file
-      xSemaphoreGive(Log_Mutex); }
+  { NMEA_Builder NMEA;
+    NMEA.Start("POGNR");                                                     // NMEA report: radio status
+    NMEA.Comma();
+    NMEA.UnsDec(RF_FreqPlan.Plan);                                           // which frequency plan
+    NMEA.Comma();
+    NMEA.UnsDec(RX_OGN_Count64);                                             // number of OGN packets received
+    NMEA.Comma();
+    NMEA.Comma();
+    NMEA.SignDec(-5*RX_AverRSSI, 2, 1);                                      // average RF level (over all channels)
+    NMEA.Comma();
+    NMEA.UnsDec((uint16_t)TX_Credit);
+    NMEA.Comma();
+    NMEA.SignDec((int16_t)RF_Temp);                                          // the temperature of the RF chip
+    NMEA.Comma();
+    // NMEA.SignDec(MCU_Temp, 2, 1);
+    NMEA.Comma();
+    // NMEA.UnsDec((MCU_VCC+5)/10, 3, 2);
+#ifdef WITH_RX_SCHED
+    NMEA.Comma();
+    NMEA.UnsDec(RxSched.Decoded);                                            // packets decoded
+    NMEA.Comma();
+    NMEA.UnsDec(RxSched.Dropped);                                            // packets dropped without decoding
+    NMEA.Comma();
+    NMEA.UnsDec(RxSched.Deferred);                                           // packets passed over for better ones
+    RxSched.Clear();
 #endif
+#ifdef WITH_LDPC_CM3
+    NMEA.Comma();
+    NMEA.UnsDec(LDPC_CM3_Iter ? LDPC_CM3_Cycles/LDPC_CM3_Iter : 0);          // [CPU cycles] per decoder iteration
+    NMEA.Comma();
+    NMEA.UnsDec(LDPC_CM3_Iter);                                              // decoder iterations
+    LDPC_CM3_Cycles=0; LDPC_CM3_Iter=0;
+#endif
+    NMEA.Finish();                                                           // append NMEA check-sum and CR+NL
+    SendNMEA(NMEA);                                                          // send the NMEA out to the console and the log file
   }
 }
 
 // ---------------------------------------------------------------------------------------------------------------------------------------
 
-static uint8_t WritePFLAU(char *NMEA, uint8_t GPS=1)    // produce the (mostly dummy) PFLAU to satisfy XCsoar and LK8000
-{ uint8_t Len=0;
-  Len+=Format_String(NMEA+Len, "$PFLAU,");
-  NMEA[Len++]='0';
-  NMEA[Len++]=',';
-  NMEA[Len++]='0'+GPS;                                  // TX status
-  NMEA[Len++]=',';
-  NMEA[Len++]='0'+GPS;                                  // GPS status
-  NMEA[Len++]=',';
-  NMEA[Len++]='1';                                      // power status: one could monitor the supply
-  NMEA[Len++]=',';
-  NMEA[Len++]='0';
-  NMEA[Len++]=',';
-  NMEA[Len++]=',';
-  NMEA[Len++]='0';
-  NMEA[Len++]=',';
-  NMEA[Len++]=',';
-  Len+=NMEA_AppendCheckCRNL(NMEA, Len);
-  NMEA[Len]=0;
-  return Len; }
+static uint8_t WritePFLAU(NMEA_Builder &NMEA, uint8_t GPS=1) // produce the (mostly dummy) PFLAU to satisfy XCsoar and LK8000
+{ NMEA.Start("PFLAU");
+  NMEA.Comma();
+  NMEA.Digit(0);
+  NMEA.Comma();
+  NMEA.Digit(GPS);                                      // TX status
+  NMEA.Comma();
+  NMEA.Digit(GPS);                                      // GPS status
+  NMEA.Comma();
+  NMEA.Digit(1);                                        // power status: one could monitor the supply
+  NMEA.Comma();
+  NMEA.Digit(0);
+  NMEA.Comma();
+  NMEA.Comma();
+  NMEA.Digit(0);
+  NMEA.Comma();
+  NMEA.Comma();
+  return NMEA.Finish(); }
 
 // ---------------------------------------------------------------------------------------------------------------------------------------
 
-static void ProcessRxPacket(OGN_RxPacket *RxPacket, uint8_t RxPacketIdx)              // process every (correctly) received packet
+#ifdef WITH_BINOUT
+static void WriteRxFrame(OGN_RxPacket *RxPacket, uint32_t RxTime, uint16_t RxmsTime, int32_t LatDist, int32_t LonDist)
+{ int32_t AltDist = RxPacket->Packet.DecodeAltitude()-GPS_Altitude/10;
+  uint8_t Len=RxPacket->WriteFrame((uint8_t *)Line, RxTime, RxmsTime, LatDist, LonDist, AltDist); // COBS frame instead of $POGNT+$PFLAA
+  xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
+  CONS_UART_WriteBlock(Line, Len);
+  xSemaphoreGive(CONS_Mutex);
+#ifdef WITH_SDLOG
+  if(Log_Free()>=128)
+  { xSemaphoreTake(Log_Mutex, portMAX_DELAY);
+    Log_WriteBlock(Line, Len);
+    xSemaphoreGive(Log_Mutex); }
+#endif
+}
+#endif
+
+static void ProcessRxPacket(OGN_RxPacket *RxPacket, uint8_t RxPacketIdx, uint32_t RxTime, uint16_t RxmsTime) // process every (correctly) received packet
 { int32_t LatDist=0, LonDist=0; uint8_t Warn=0;
   if( RxPacket->Packet.Header.Other || RxPacket->Packet.Header.Encrypted ) return ;   // status packet or encrypted: ignore
   uint8_t MyOwnPacket = ( RxPacket->Packet.Header.Address  == Parameters.Address  )
@@ -139,25 +186,21 @@ static void ProcessRxPacket(OGN_RxPacket *RxPacket, uint8_t RxPacketIdx)
   if(DistOK)
   { RxPacket->calcRelayRank(GPS_Altitude/10);                                         // calculate the relay-rank (priority for relay)
     RelayQueue.addNew(RxPacketIdx);
-    uint8_t Len=RxPacket->WritePOGNT(Line);                                           // print on the console as $POGNT
-    xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
-    Format_String(CONS_UART_Write, Line, 0, Len);
-    xSemaphoreGive(CONS_Mutex);
 #ifdef WITH_BEEPER
     if(KNOB_Tick>12) Play(Play_Vol_1 | Play_Oct_2 | 7, 3);                            // if Knob>12 => make a beep for every received packet
 #endif
-#ifdef WITH_SDLOG
-    if(Log_Free()>=128)
-    { xSemaphoreTake(Log_Mutex, portMAX_DELAY);
-      Format_String(Log_Write, Line, Len, 0);
-      xSemaphoreGive(Log_Mutex); }
+#ifdef WITH_BINOUT
+    if(Parameters.BinOut) WriteRxFrame(RxPacket, RxTime, RxmsTime, LatDist, LonDist); // binary frame on the console and the log
+    else
 #endif
+    { NMEA_Builder NMEA;
+      RxPacket->WritePOGNT(NMEA);                                                     // print on the console as $POGNT
+      SendNMEA(NMEA);
 #ifdef WITH_PFLAA
-    Len=RxPacket->Packet.WritePFLAA(Line, Warn, LatDist, LonDist, RxPacket->Packet.DecodeAltitude()-GPS_Altitude/10); // print on the console
-    xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
-    Format_String(CONS_UART_Write, Line, 0, Len);
-    xSemaphoreGive(CONS_Mutex);
+      RxPacket->Packet.WritePFLAA(NMEA, Warn, LatDist, LonDist, RxPacket->Packet.DecodeAltitude()-GPS_Altitude/10); // print on the console
+      SendNMEA(NMEA, 0);
 #endif
+    }
 #ifdef WITH_MAVLINK
     MAV_ADSB_VEHICLE MAV_RxReport;
     RxPacket->Packet.Encode(&MAV_RxReport);
@@ -169,7 +212,7 @@ static void ProcessRxPacket(OGN_RxPacket *RxPacket, uint8_t RxPacketIdx)
   }
 }
 
-static void DecodeRxPacket(RFM_RxPktData *RxPkt)
+static void DecodeRxPacket(RFM_RxPktData *RxPkt, uint8_t Iter=RFM_RxPktData::MaxIter)
 {
   uint8_t RxPacketIdx  = RelayQueue.getNew();                   // get place for this new packet
   OGN_RxPacket *RxPacket = RelayQueue[RxPacketIdx];
@@ -178,7 +221,15 @@ static void DecodeRxPacket(RFM_RxPktData *RxPkt)
   // TickType_t ExecTime=xTaskGetTickCount();
 
   { RX_OGN_Packets++;
-    uint8_t Check = RxPkt->Decode(*RxPacket, Decoder);
+    uint8_t Check = RxPkt->Decode(*RxPacket, Decoder, Iter, 256, RX_AverRSSI);
+#ifdef WITH_RX_COMBINE
+    if( (Check!=0) || (RxPacket->RxErr>=15) )                  // not good enough: combine with earlier copies of the same packet
+    { uint8_t CacheIdx = RxCache.Add(*RxPkt);
+      if(RxCache.Copies[CacheIdx]>1)
+      { Check = RxCache.Decode(CacheIdx, *RxPacket, Decoder, Iter);
+        if( (Check==0) && (RxPacket->RxErr<15) ) RxCache.Remove(CacheIdx); }
+    }
+#endif
 #ifdef DEBUG_PRINT
     xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
     Format_String(CONS_UART_Write, "RxPacket: ");
@@ -192,7 +243,7 @@ static void DecodeRxPacket(RFM_RxPktData *RxPkt)
 #endif
     if( (Check==0) && (RxPacket->RxErr<15) )                     // what limit on number of detected bit errors ?
     { RxPacket->Packet.Dewhiten();
-      ProcessRxPacket(RxPacket, RxPacketIdx); }
+      ProcessRxPacket(RxPacket, RxPacketIdx, RxPkt->Time, RxPkt->msTime); }
   }
 
 }
@@ -213,6 +264,9 @@ void vTaskPROC(void* pvParameters)
   xSemaphoreGive(CONS_Mutex);
 #endif
   RelayQueue.Clear();
+#ifdef WITH_LDPC_CM3
+  LDPC_CM3_CountCycles();                                               // DWT cycle counts of the decoder kernel for $POGNR
+#endif
 
   static uint16_t AverSpeed=0;                                          // [0.1m/s] average speed (including vertical)
   static bool     isMoving=0;                                           // is the aircraft moving ?
@@ -225,7 +279,15 @@ void vTaskPROC(void* pvParameters)
   for( ; ; )
   { vTaskDelay(1);
 
+#ifdef WITH_RX_SCHED
+    uint16_t msTime = TimeSync_msTime();
+    RFM_RxPktData *RxPkt = RxSched.Select(RF_RxFIFO, RX_AverRSSI, msTime); // the best of the received packets
+    uint8_t Iter = RxPkt ? RxSched.getBudget(RF_RxFIFO, RX_AverRSSI, msTime) : 0;
+    if(RxPkt && Iter==0) { RF_RxFIFO.Read(); RxPkt=0; }                  // hopeless or too old: drop without decoding
+#else
     RFM_RxPktData *RxPkt = RF_RxFIFO.getRead();                         // check for new received packets
+    uint8_t Iter = RFM_RxPktData::MaxIter;
+#endif
     if(RxPkt)
     {
 #ifdef DEBUG_PRINT
@@ -238,7 +300,7 @@ void vTaskPROC(void* pvParameters)
       // CONS_UART_Write('\r'); CONS_UART_Write('\n');
       xSemaphoreGive(CONS_Mutex);
 #endif
-      DecodeRxPacket(RxPkt);                                            // decode and process the received packet
+      DecodeRxPacket(RxPkt, Iter);                                      // decode and process the received packet
       RF_RxFIFO.Read(); }
 
     static uint32_t PrevSlotTime=0;                                     // remember previous time slot to detect a change
@@ -310,10 +372,9 @@ void vTaskPROC(void* pvParameters)
         RF_TxFIFO.Write();                                              // complete the write into the TxFIFO
       Position->Sent=1;
 #ifdef WITH_PFLAA
-      { uint8_t Len=WritePFLAU(Line);
-        xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
-        Format_String(CONS_UART_Write, Line, 0, Len);
-        xSemaphoreGive(CONS_Mutex); }
+      { NMEA_Builder NMEA;
+        WritePFLAU(NMEA);
+        SendNMEA(NMEA, 0); }
 #endif // WITH_PFLAA
 #ifdef WITH_FLASHLOG
       bool Written=FlashLog_Process(PosPacket.Packet, PosTime);
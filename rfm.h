@@ -1,7 +1,16 @@
+#ifndef __RFM_H__
+#define __RFM_H__
+
 // -----------------------------------------------------------------------------------------------------------------------
 
 #include "ogn.h"
 
+#ifdef WITH_LDPC_COMPACT
+typedef LDPC_Decoder8 RFM_RxDecoder;  // int8 layered decoder: less than half the RAM of LDPC_Decoder
+#else
+typedef LDPC_Decoder  RFM_RxDecoder;
+#endif
+
 class RFM_RxPktData                  // packet received by the RF chip
 { public:
    static const uint8_t Bytes=26;   // [bytes] number of bytes in the packet
@@ -50,14 +59,85 @@ class RFM_RxPktData                  // packet received by the RF chip
        Count+=Count1s((uint8_t)((Data[Idx]^Corr[Idx])&(~Err[Idx])));
      return Count; }
 
-  uint8_t Decode(OGN_RxPacket &Packet, LDPC_Decoder &Decoder, uint8_t Iter=32) const
-  { uint8_t Check=0;
-    uint8_t RxErr = ErrCount();                                // conunt Manchester decoding errors
-    Decoder.Input(Data, Err);                                  // put data into the FEC decoder
+#ifdef WITH_RX_SOFT
+  static const uint8_t SoftWin   =   6;    // [bits] Manchester errors are counted this far either side of a bit
+  static const int16_t SoftLevel = 128;    // a bit with no errors around: the level of LDPC_Decoder::Input(Data, Err)
+  static const int16_t SoftStep  =  32;    // less per every error above the threshold
+  static const int16_t SoftMin   =  16;    // but not less than this
+
+  // Graded soft input: no information where Manchester decoding failed, full confidence for a valid bit,
+  // unless it sits among more Manchester errors than their average density in the packet explains:
+  // then it is likely hit by the same burst of interference and the confidence drops with every extra error.
+  // Noise = RX_AverRSSI (0 = not known): a packet well over the noise with a burst of errors is hit by interference
+  // rather than noise, thus the steps are larger.
+  template <class Decoder>
+   void SoftInput(Decoder &Dec, uint8_t Noise=0) const
+  { const uint8_t Bits=8*Bytes;
+    uint8_t Thres = 1 + (4*SoftWin*ErrCount()+Bits-1)/Bits;  // twice the errors expected in the window, plus one
+    int16_t Step = SoftStep;
+    if(Noise && RSSI+20<=Noise) Step+=Step>>1;                // [-0.5dBm] more than 10dB over the noise
+    Dec.Clear();
+    uint8_t Near=0;                                            // Manchester errors around the bit
+    for(uint8_t Bit=0; Bit<SoftWin; Bit++) Near+=isErr(Bit);
+    for(uint8_t Bit=0; Bit<Bits; Bit++)                        // in the order of transmission: MSB of every byte first
+    { if(Bit+SoftWin<Bits) Near+=isErr(Bit+SoftWin);
+      if(Bit>SoftWin) Near-=isErr(Bit-SoftWin-1);
+      uint8_t Byte=Bit>>3; uint8_t Mask=0x80>>(Bit&7);
+      if(Err[Byte]&Mask) continue;                             // Manchester error: leave it unknown
+      int16_t Level=SoftLevel;
+      if(Near>=Thres)
+      { Level-=(Near+1-Thres)*Step; if(Level<SoftMin) Level=SoftMin; }
+      Dec.addInput(Bit^7, (Data[Byte]&Mask) ? Level:-Level); }
+  }
+
+  uint8_t isErr(uint8_t Bit) const { return (Err[Bit>>3]>>(7-(Bit&7)))&1; } // Manchester error, bits in the order of transmission
+#endif
+
+#if defined(WITH_LDPC_LAYERED) || defined(WITH_LDPC_COMPACT)
+  static const uint8_t MaxIter=16;                             // layered schedule needs about half the iterations
+#else
+  static const uint8_t MaxIter=32;
+#endif
+
+  static uint8_t Iterate(RFM_RxDecoder &Decoder, uint8_t Iter=MaxIter) // iterate the FEC decoder, return the number of failed checks
+  { uint8_t Check=0;                                           // Iter: iterations of the schedule in use, not halved here
     for( ; Iter; Iter--)                                       // more loops is more chance to recover the packet
-    { Check=Decoder.ProcessChecks();                           // do an iteration
+    {
+#ifdef WITH_LDPC_LAYERED
+      Check=Decoder.ProcessChecksLayered();                    // do a layered iteration: stops as soon as all checks pass
+#else
+      Check=Decoder.ProcessChecks();                           // do an iteration
+#endif
       if(Check==0) break; }                                    // if FEC all fine: break
-    Decoder.Output(Packet.Packet.Byte());                      // get corrected bytes into the OGN packet
+    return Check; }
+
+#ifdef WITH_LDPC_CHASE
+  static const uint8_t ChaseBits=8;                            // number of least reliable bits the Chase stage flips
+#endif
+
+  uint8_t Decode(OGN_RxPacket &Packet, RFM_RxDecoder &Decoder, uint8_t Iter=MaxIter, uint16_t ChaseTests=256, uint8_t Noise=0) const // ChaseTests: CPU budget of the Chase stage, Noise: RX_AverRSSI
+  { uint8_t Check=0;
+    uint8_t RxErr = ErrCount();                                // conunt Manchester decoding errors
+#ifdef WITH_LDPC_SYNDROME
+    uint8_t *Corr = Packet.Packet.Byte();
+    for(uint8_t Idx=0; Idx<Bytes; Idx++) Corr[Idx]=Data[Idx];  // try the syndrome table first:
+    if(LDPC_FastCorrect(Corr, Err)<0)                          // clean packets and 1-2 bit errors need no soft decoding
+#endif
+    {
+#ifdef WITH_RX_SOFT
+      SoftInput(Decoder, Noise);                               // graded soft bits into the FEC decoder
+#else
+      Decoder.Input(Data, Err);                                // put data into the FEC decoder
+#endif
+      Check=Iterate(Decoder, Iter);
+#ifdef WITH_LDPC_CHASE
+      bool Chase = Check && Decoder.ChaseCorrect(Err, ChaseBits, ChaseTests)>=0; // failed: try flipping the least reliable bits
+#endif
+      Decoder.Output(Packet.Packet.Byte());                    // get corrected bytes into the OGN packet
+#ifdef WITH_LDPC_CHASE
+      if(Chase) Check=LDPC_Check(Packet.Packet.Byte());        // confirm the Chase correction
+#endif
+    }
     RxErr += ErrCount(Packet.Packet.Byte());
     if(RxErr>15) RxErr=15;
     Packet.RxErr  = RxErr;
@@ -68,6 +148,101 @@ class RFM_RxPktData                  // packet received by the RF chip
 
 } ;
 
+#ifdef WITH_RX_COMBINE
+
+// The same packet is often received more than once: in both time slots or on two channels.
+// Copies which fail to decode are kept here and soft-combined: every copy votes +1/-1 for each bit
+// or 0 where Manchester decoding flagged an error, the sum goes into the LDPC decoder.
+// Copies are matched by content: bits where both copies are (Manchester) valid should mostly agree.
+// A relayed copy does not match as its header and thus the parity bits differ.
+
+template <uint8_t Size=4>
+ class RFM_RxPktCache
+{ public:
+   static const uint8_t Bytes     = RFM_RxPktData::Bytes;
+   static const uint8_t Bits      = 8*Bytes;
+   static const uint8_t MaxDist   = 40;     // [bits] max. number of disagreeing bits for two copies of the same packet
+   static const uint8_t MaxAge    =  2;     // [sec] copies older than this are not matched
+   static const uint8_t MaxCopies = 16;     // limit so the sums fit int8_t and the decoder input does not saturate
+
+   uint32_t Time   [Size];                  // [sec] time slot of the last copy
+   uint8_t  Copies [Size];                  // number of combined copies, 0 = free entry
+   uint8_t  Channel[Size];                  // RF channel of the last copy
+   uint8_t  RSSI   [Size];                  // [-0.5dBm] best RSSI of the copies
+   int8_t   Sum    [Size][Bits];            // votes of the copies for every bit: +1 = "1", -1 = "0", 0 = unknown
+
+  public:
+   RFM_RxPktCache() { Clear(); }
+
+   void Clear(void)
+   { for(uint8_t Idx=0; Idx<Size; Idx++) Copies[Idx]=0; }
+
+   void Remove(uint8_t Idx) { Copies[Idx]=0; }
+
+   bool isOld(uint8_t Idx, uint32_t Now) const { return (Now-Time[Idx])>MaxAge; }
+
+   uint8_t Dist(uint8_t Idx, const RFM_RxPktData &Pkt) const       // number of valid bits where the copy disagrees with the entry
+   { uint8_t Count=0; const int8_t *Vote=Sum[Idx];
+     for(uint8_t Byte=0; Byte<Bytes; Byte++)
+     { uint8_t Data=Pkt.Data[Byte]; uint8_t Err=Pkt.Err[Byte];
+       for(uint8_t Mask=1; Mask; Mask<<=1, Vote++)
+       { if((Err&Mask) || (*Vote)==0) continue;
+         if( ((*Vote)>0) != ((Data&Mask)!=0) ) Count++; }
+     }
+     return Count; }
+
+   int8_t Find(const RFM_RxPktData &Pkt) const                      // find the entry which matches best, -1 if none
+   { int8_t Best=(-1); uint8_t BestDist=MaxDist+1;
+     for(uint8_t Idx=0; Idx<Size; Idx++)
+     { if(Copies[Idx]==0 || isOld(Idx, Pkt.Time)) continue;
+       uint8_t D=Dist(Idx, Pkt);
+       if(D<BestDist) { Best=Idx; BestDist=D; }
+     }
+     return Best; }
+
+   uint8_t Add(const RFM_RxPktData &Pkt)                            // add the copy to the matching entry or start a new one, return the entry
+   { int8_t Idx=Find(Pkt);
+     if(Idx<0)                                                      // no match: take a free, an old or the oldest entry
+     { Idx=0;
+       for(uint8_t New=0; New<Size; New++)
+       { if(Copies[New]==0 || isOld(New, Pkt.Time)) { Idx=New; break; }
+         if((int32_t)(Time[New]-Time[Idx])<0) Idx=New; }
+       Copies[Idx]=0; RSSI[Idx]=0xFF;
+       for(uint8_t Bit=0; Bit<Bits; Bit++) Sum[Idx][Bit]=0; }
+     if(Copies[Idx]>=MaxCopies) return Idx;
+     int8_t *Vote=Sum[Idx];
+     for(uint8_t Byte=0; Byte<Bytes; Byte++)
+     { uint8_t Data=Pkt.Data[Byte]; uint8_t Err=Pkt.Err[Byte];
+       for(uint8_t Mask=1; Mask; Mask<<=1, Vote++)
+       { if(Err&Mask) continue;
+         if(Data&Mask) (*Vote)++;
+                  else (*Vote)--; }
+     }
+     Copies[Idx]++; Time[Idx]=Pkt.Time; Channel[Idx]=Pkt.Channel;
+     if(Pkt.RSSI<RSSI[Idx]) RSSI[Idx]=Pkt.RSSI;                     // RSSI is in -0.5dBm units: lower is stronger
+     return Idx; }
+
+   uint8_t Decode(uint8_t Idx, OGN_RxPacket &Packet, RFM_RxDecoder &Decoder, uint8_t Iter=RFM_RxPktData::MaxIter) const // decode the combined copies
+   { Decoder.Input(Sum[Idx]);
+     uint8_t Check=RFM_RxPktData::Iterate(Decoder, Iter);
+     Decoder.Output(Packet.Packet.Byte());
+     const uint8_t *Corr = Packet.Packet.Byte(); const int8_t *Vote=Sum[Idx];
+     uint8_t RxErr=0;                                               // count bits still unknown or disagreeing with the corrected packet
+     for(uint8_t Byte=0; Byte<Bytes; Byte++)
+     { for(uint8_t Mask=1; Mask; Mask<<=1, Vote++)
+       { if( (*Vote)==0 || ((*Vote)>0) != ((Corr[Byte]&Mask)!=0) ) RxErr++; }
+     }
+     if(RxErr>15) RxErr=15;
+     Packet.RxErr  = RxErr;
+     Packet.RxChan = Channel[Idx];
+     Packet.RxRSSI = RSSI[Idx];
+     Packet.Corr   = Check==0;
+     return Check; }
+
+} ;
+
+#endif // WITH_RX_COMBINE
+
 // -----------------------------------------------------------------------------------------------------------------------
 
 // OGN frequencies for Europe: 868.2 and 868.4 MHz
@@ -89,6 +264,7 @@ class RFM_RxPktData                  // packet received by the RF chip
 //                                                            or: IntFreq = ((Freq<<11)+ 62)/125; where Freq is in [  1kHz]
 // 32-bit arythmetic is enough in the above formulas
 
+#if defined(WITH_RFM69) || defined(WITH_RFM95) || defined(WITH_SX1272) // the RF chip interface: not needed for host tests of the above
 
 #ifdef WITH_RFM69
 
@@ -483,4 +659,6 @@ class RFM_TRX
 */
 } ;
 
+#endif // of WITH_RFM69 || WITH_RFM95 || WITH_SX1272
 
+#endif // __RFM_H__
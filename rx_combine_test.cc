@@ -0,0 +1,70 @@
+// g++ -std=gnu++14 -O2 -I. -DWITH_RX_COMBINE -o rx_combine_test rx_combine_test.cc ldpc.cpp bitcount.cpp
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "rfm.h"
+#include "ldpc_channel.h"
+
+const int Packets = 2000;
+
+static RFM_RxDecoder Decoder;
+
+static void MakeCopy(RFM_RxPktData &Pkt, const LDPC_Channel &Channel, const uint8_t *Code, uint32_t Time, uint8_t Chan)
+{ Channel.Transmit(Pkt.Data, Pkt.Err, 0, Code, RFM_RxPktData::Bytes);
+  Pkt.Time=Time; Pkt.msTime=400+Chan*400; Pkt.Channel=Chan; Pkt.RSSI=200; }
+
+static int TestMatch(void)                         // copies of different packets must not be combined
+{ LDPC_Channel Channel(LDPC_Channel::Erasure);
+  Channel.setEbN0(4.0, 160.0/208);
+  static RFM_RxPktCache<4> Cache;
+  int Match=0; int Tries=0;
+  for(int Pkt=0; Pkt<Packets; Pkt++)
+  { uint8_t Code[26];
+    for(int Idx=0; Idx<20; Idx++) Code[Idx]=rand();
+    LDPC_Encode(Code);
+    RFM_RxPktData Copy; MakeCopy(Copy, Channel, Code, Pkt/4, 0);
+    if(Cache.Find(Copy)>=0) Match++;
+    Tries++;
+    Cache.Add(Copy); }
+  printf("Different packets: %d false matches in %d tries\n", Match, Tries);
+  return Match; }
+
+int main(int argc, char *argv[])
+{ srand(argc>1 ? atoi(argv[1]):1);
+  int Fail=TestMatch();
+  printf("Eb/N0 copies  single-copy FER  combined FER  wrong\n");
+  for(int Copies=2; Copies<=3; Copies++)
+  { for(float EbN0=3.0; EbN0<=6.01; EbN0+=1.0)
+    { LDPC_Channel Channel(LDPC_Channel::Erasure);
+      Channel.setEbN0(EbN0, 160.0/208);
+      static RFM_RxPktCache<4> Cache; Cache.Clear();
+      int SingleErr=0; int CombErr=0; int Wrong=0;
+      for(int Pkt=0; Pkt<Packets; Pkt++)
+      { uint8_t Code[26];
+        for(int Idx=0; Idx<20; Idx++) Code[Idx]=rand();
+        LDPC_Encode(Code);
+        bool Single=0; bool Comb=0;
+        for(int Copy=0; Copy<Copies; Copy++)                  // as in DecodeRxPacket(): decode alone, combine when failed
+        { RFM_RxPktData RxPkt; MakeCopy(RxPkt, Channel, Code, Pkt, Copy);
+          OGN_RxPacket RxPacket;
+          uint8_t Check=RxPkt.Decode(RxPacket, Decoder);
+          if(Check==0 && RxPacket.RxErr<15) Single=1;          // DecodeRxPacket() accepts packets with less than 15 errors
+          else
+          { uint8_t Idx=Cache.Add(RxPkt);
+            if(Cache.Copies[Idx]>1)
+            { Check=Cache.Decode(Idx, RxPacket, Decoder);
+              if(Check==0 && RxPacket.RxErr<15) Cache.Remove(Idx); }
+          }
+          if(Check==0 && RxPacket.RxErr<15)
+          { Comb=1;
+            if(memcmp(RxPacket.Byte(), Code, 26)) Wrong++; }
+        }
+        if(!Single) SingleErr++;
+        if(!Comb) CombErr++; }
+      printf("%4.1f    %d      %8.4f      %8.4f    %4d\n", EbN0, Copies, (double)SingleErr/Packets, (double)CombErr/Packets, Wrong);
+      if(CombErr>SingleErr || 500*Wrong>Packets) Fail++; }           // allow rare false corrections at the lowest Eb/N0, like for single copies
+  }
+  return Fail ? 1:0; }
@@ -0,0 +1,190 @@
+#ifndef __RX_FARM_H__
+#define __RX_FARM_H__
+
+// Host-side decode farm for recorded streams of received packets, like a ground receiver on Linux or an offline analysis:
+// the raw RFM_RxPktData records are decoded by a pool of threads, every thread with its own decoder.
+// The packets are taken in batches: the reader deals the batches to the threads in turn, a thread which runs out of work
+// steals from the others. The number of batches in flight is bounded, thus so are the input queues and the reorder buffer.
+// The results come out in the input order, which is the time order of a recording.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "rfm.h"
+
+class RX_FarmRecord                             // binary stream format: fixed size records, little-endian
+{ public:
+   static const int RawSize = 4+2+1+1+2*RFM_RxPktData::Bytes;     // Time, msTime, Channel, RSSI, Data[], Err[]
+   static const int OutSize = 4+2+1+1+1+1+RFM_RxPktData::Bytes;   // Time, msTime, Channel, RSSI, Check, Corr/RxErr, Packet[]
+
+   static void Put(uint8_t *Ptr, uint32_t Value, int Bytes) { for( ; Bytes; Bytes--, Value>>=8) *Ptr++ = Value; }
+   static uint32_t Get(const uint8_t *Ptr, int Bytes) { uint32_t Value=0; for(int Idx=Bytes-1; Idx>=0; Idx--) Value = (Value<<8) | Ptr[Idx]; return Value; }
+
+   static bool Read(FILE *File, RFM_RxPktData &Pkt)                 // read a raw packet, false at the end of the stream
+   { uint8_t Rec[RawSize];
+     if(fread(Rec, RawSize, 1, File)!=1) return 0;
+     Pkt.Time=Get(Rec, 4); Pkt.msTime=Get(Rec+4, 2); Pkt.Channel=Rec[6]; Pkt.RSSI=Rec[7];
+     memcpy(Pkt.Data, Rec+8, RFM_RxPktData::Bytes);
+     memcpy(Pkt.Err,  Rec+8+RFM_RxPktData::Bytes, RFM_RxPktData::Bytes);
+     return 1; }
+
+   static bool Write(FILE *File, const RFM_RxPktData &Pkt)
+   { uint8_t Rec[RawSize];
+     Put(Rec, Pkt.Time, 4); Put(Rec+4, Pkt.msTime, 2); Rec[6]=Pkt.Channel; Rec[7]=Pkt.RSSI;
+     memcpy(Rec+8, Pkt.Data, RFM_RxPktData::Bytes);
+     memcpy(Rec+8+RFM_RxPktData::Bytes, Pkt.Err, RFM_RxPktData::Bytes);
+     return fwrite(Rec, RawSize, 1, File)==1; }
+
+   static bool Write(FILE *File, const RFM_RxPktData &Pkt, const OGN_RxPacket &Packet, uint8_t Check) // write a decoded packet
+   { uint8_t Rec[OutSize];
+     Put(Rec, Pkt.Time, 4); Put(Rec+4, Pkt.msTime, 2); Rec[6]=Packet.RxChan; Rec[7]=Packet.RxRSSI;
+     Rec[8]=Check; Rec[9]=Packet.State;
+     memcpy(Rec+10, Packet.Byte(), RFM_RxPktData::Bytes);
+     return fwrite(Rec, OutSize, 1, File)==1; }
+} ;
+
+class RX_DecodeFarm
+{ public:
+   static const int Batch = 64;                 // packets per unit of work
+
+   typedef std::function<bool (RFM_RxPktData &Pkt)> Source;                                 // false = end of input
+   typedef std::function<void (const RFM_RxPktData &Pkt, const OGN_RxPacket &Packet, uint8_t Check)> Sink; // called in the input order
+
+   uint8_t  Iter;                               // decoder iterations per packet
+   uint64_t Packets;                            // [packets] decoded
+   uint64_t Correct;                            // [packets] which passed all parity checks
+   uint64_t Steals;                             // [batches] taken from other threads' queues
+
+  private:
+   struct Job
+   { uint64_t      Seq;                         // batch number in the input order
+     int           Count;                       // packets in this batch
+     RFM_RxPktData Pkt[Batch];
+     OGN_RxPacket  Packet[Batch];
+     uint8_t       Check[Batch];
+     bool          Done; } ;
+
+   struct Worker
+   { std::mutex        Lock;
+     std::deque<Job *> Queue;                   // the owner takes from the front (oldest), thieves from the back
+     RFM_RxDecoder     Decoder;                 // every thread has its own decoder
+     uint64_t          Packets;
+     uint64_t          Steals; } ;
+
+   int                   Threads;
+   int                   Slots;                 // batches in flight: bounds the queues and the reorder buffer
+   std::vector<Job>      Jobs;                  // Jobs[Seq%Slots]
+   std::vector<Worker *> Workers;
+
+   std::mutex              Lock;                // for the conditions below
+   std::condition_variable WorkReady;           // a batch was queued or the input ended
+   std::condition_variable SlotFree;            // the writer released a batch
+   std::condition_variable JobDone;             // a worker finished a batch
+   std::atomic<int>        Queued;              // batches waiting in the worker queues
+   uint64_t                Written;             // batches given to the Sink
+   uint64_t                Total;               // batches in the input, known when it ends
+   bool                    InputEnd;
+
+  public:
+   RX_DecodeFarm(int Threads=0, int Slots=0, uint8_t Iter=RFM_RxPktData::MaxIter)
+   { if(Threads<=0) Threads=std::thread::hardware_concurrency();
+     if(Threads<=0) Threads=1;
+     if(Slots<=0) Slots=4*Threads;
+     if(Slots<2) Slots=2;
+     this->Threads=Threads; this->Slots=Slots; this->Iter=Iter;
+     Jobs.resize(Slots);
+     for(int Idx=0; Idx<Threads; Idx++) Workers.push_back(new Worker);
+     Packets=0; Correct=0; Steals=0; }
+
+   ~RX_DecodeFarm()
+   { for(size_t Idx=0; Idx<Workers.size(); Idx++) delete Workers[Idx]; }
+
+   int getThreads(void) const { return Threads; }
+   uint64_t getPackets(int Thread) const { return Workers[Thread]->Packets; }
+
+   uint64_t Run(Source Read, Sink Write)        // decode all packets from Read, give the results to Write in the input order
+   { Queued=0; Written=0; Total=(uint64_t)(-1); InputEnd=0; Packets=0; Correct=0; Steals=0;
+     for(int Idx=0; Idx<Threads; Idx++) { Workers[Idx]->Packets=0; Workers[Idx]->Steals=0; }
+     for(int Idx=0; Idx<Slots; Idx++) { Jobs[Idx].Seq=(uint64_t)(-1); Jobs[Idx].Done=0; }
+     std::vector<std::thread> Pool;
+     for(int Idx=0; Idx<Threads; Idx++) Pool.push_back(std::thread(&RX_DecodeFarm::Work, this, Idx));
+     std::thread Writer(&RX_DecodeFarm::Emit, this, std::ref(Write));
+     uint64_t Seq=0;
+     for( ; ; Seq++)                                            // the calling thread reads the input
+     { Job &J = Jobs[Seq%Slots];
+       { std::unique_lock<std::mutex> Wait(Lock);
+         SlotFree.wait(Wait, [&] { return Seq<Written+Slots; } ); // bounded: wait till the writer releases the slot
+         J.Seq=Seq; J.Done=0; }
+       J.Count=0;
+       while(J.Count<Batch && Read(J.Pkt[J.Count])) J.Count++;
+       if(J.Count==0) break;
+       { std::lock_guard<std::mutex> Guard(Lock); Queued++; }
+       Worker &W = *Workers[Seq%Threads];                       // deal the batches in turn
+       { std::lock_guard<std::mutex> Guard(W.Lock); W.Queue.push_back(&J); }
+       WorkReady.notify_all();
+       if(J.Count<Batch) { Seq++; break; } }
+     { std::lock_guard<std::mutex> Guard(Lock); InputEnd=1; Total=Seq; }
+     WorkReady.notify_all(); JobDone.notify_all();
+     for(int Idx=0; Idx<Threads; Idx++) Pool[Idx].join();
+     Writer.join();
+     for(int Idx=0; Idx<Threads; Idx++) { Packets+=Workers[Idx]->Packets; Steals+=Workers[Idx]->Steals; }
+     return Packets; }
+
+   uint64_t Run(FILE *Inp, FILE *Out)           // binary streams of RX_FarmRecord
+   { return Run([Inp] (RFM_RxPktData &Pkt) { return RX_FarmRecord::Read(Inp, Pkt); },
+                [Out] (const RFM_RxPktData &Pkt, const OGN_RxPacket &Packet, uint8_t Check) { RX_FarmRecord::Write(Out, Pkt, Packet, Check); } ); }
+
+  private:
+   Job *Take(int Self)                          // own queue first, then steal from the others
+   { for(int Idx=0; Idx<Threads; Idx++)
+     { Worker &W = *Workers[(Self+Idx)%Threads];
+       std::lock_guard<std::mutex> Guard(W.Lock);
+       if(W.Queue.empty()) continue;
+       Job *J;
+       if(Idx==0) { J=W.Queue.front(); W.Queue.pop_front(); }
+             else { J=W.Queue.back();  W.Queue.pop_back(); Workers[Self]->Steals++; }
+       Queued--; return J; }
+     return 0; }
+
+   void Work(int Self)
+   { Worker &W = *Workers[Self];
+     for( ; ; )
+     { Job *J=Take(Self);
+       if(J==0)
+       { std::unique_lock<std::mutex> Wait(Lock);
+         WorkReady.wait(Wait, [this] { return Queued>0 || InputEnd; } );
+         if(Queued==0 && InputEnd) break;
+         continue; }
+       for(int Idx=0; Idx<J->Count; Idx++)
+       { J->Packet[Idx].Clear();
+         J->Check[Idx] = J->Pkt[Idx].Decode(J->Packet[Idx], W.Decoder, Iter); }
+       W.Packets+=J->Count;
+       { std::lock_guard<std::mutex> Guard(Lock); J->Done=1; }
+       JobDone.notify_all(); }
+   }
+
+   void Emit(Sink &Write)                       // give the batches to the Sink in order and release their slots
+   { for( ; ; )
+     { Job &J = Jobs[Written%Slots];
+       { std::unique_lock<std::mutex> Wait(Lock);
+         JobDone.wait(Wait, [&] { return Written>=Total || (J.Seq==Written && J.Done); } );
+         if(Written>=Total) break; }
+       for(int Idx=0; Idx<J.Count; Idx++)
+       { if(J.Check[Idx]==0) Correct++;
+         Write(J.Pkt[Idx], J.Packet[Idx], J.Check[Idx]); }
+       { std::lock_guard<std::mutex> Guard(Lock); Written++; }
+       SlotFree.notify_all(); }
+   }
+
+} ;
+
+#endif // __RX_FARM_H__
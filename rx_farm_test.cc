@@ -0,0 +1,73 @@
+// g++ -std=gnu++14 -O2 -I. -pthread -o rx_farm_test rx_farm_test.cc ldpc.cpp bitcount.cpp
+// ./rx_farm_test [packets] [max threads]
+
+// Throughput of RX_DecodeFarm over a recorded stream of received packets for an increasing number of threads.
+// Every run must give exactly the results of decoding the stream packet by packet, in the same order.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <chrono>
+
+#include "rx_farm.h"
+#include "ldpc_channel.h"
+
+static double Wall_Time(void)
+{ return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count(); }
+
+static void MakeStream(FILE *File, int Packets)   // a recording: packets from 3 to 9 dB Eb/N0, in time order
+{ LDPC_Channel Channel(LDPC_Channel::AWGN);
+  uint32_t Time=1500000000; uint16_t msTime=400;
+  for(int Pkt=0; Pkt<Packets; Pkt++)
+  { uint8_t Code[26];
+    for(int Idx=0; Idx<20; Idx++) Code[Idx]=rand();
+    LDPC_Encode(Code);
+    float EbN0 = 3.0+6.0*LDPC_Channel::Uniform();
+    Channel.setEbN0(EbN0, 160.0/208);
+    RFM_RxPktData RxPkt;
+    Channel.Transmit(RxPkt.Data, RxPkt.Err, 0, Code, RFM_RxPktData::Bytes);
+    msTime += 1+rand()%20; if(msTime>=1200) { Time++; msTime-=800; }
+    RxPkt.Time=Time; RxPkt.msTime=msTime; RxPkt.Channel=msTime>=800; RxPkt.RSSI=200-(int)(2*EbN0);
+    RX_FarmRecord::Write(File, RxPkt); }
+}
+
+int main(int argc, char *argv[])
+{ int Packets    = argc>1 ? atoi(argv[1]):50000;
+  int MaxThreads = argc>2 ? atoi(argv[2]):std::thread::hardware_concurrency();
+  if(MaxThreads<2) MaxThreads=2;                                 // at least check that two threads give the same results
+  srand(1);
+  FILE *Inp=tmpfile(); MakeStream(Inp, Packets);
+
+  uint8_t *Ref = new uint8_t[(size_t)Packets*RX_FarmRecord::OutSize];  // reference: one packet at a time
+  { static RFM_RxDecoder Decoder;
+    rewind(Inp); FILE *Out=fmemopen(Ref, (size_t)Packets*RX_FarmRecord::OutSize, "wb");
+    RFM_RxPktData RxPkt; int Count=0;
+    double Start=Wall_Time();
+    while(RX_FarmRecord::Read(Inp, RxPkt))
+    { OGN_RxPacket Packet;
+      uint8_t Check=RxPkt.Decode(Packet, Decoder);
+      RX_FarmRecord::Write(Out, RxPkt, Packet, Check); Count++; }
+    double Time=Wall_Time()-Start;
+    fclose(Out);
+    printf("single    : %8d packets, %9.0f packets/sec\n", Count, Count/Time); }
+
+  int Fail=0; double Base=0;
+  uint8_t *Res = new uint8_t[(size_t)Packets*RX_FarmRecord::OutSize];
+  for(int Threads=1; Threads<=MaxThreads; Threads*=2)
+  { RX_DecodeFarm Farm(Threads);
+    memset(Res, 0, (size_t)Packets*RX_FarmRecord::OutSize);
+    rewind(Inp); FILE *Out=fmemopen(Res, (size_t)Packets*RX_FarmRecord::OutSize, "wb");
+    double Start=Wall_Time();
+    uint64_t Count=Farm.Run(Inp, Out);
+    double Time=Wall_Time()-Start;
+    fclose(Out);
+    double Rate=Count/Time; if(Threads==1) Base=Rate;
+    bool Same = Count==(uint64_t)Packets && memcmp(Ref, Res, (size_t)Packets*RX_FarmRecord::OutSize)==0;
+    if(!Same) Fail++;
+    printf("%2d threads: %8d packets, %9.0f packets/sec (x%4.2f), %6d steals, %6d correct, %s\n",
+           Threads, (int)Count, Rate, Rate/Base, (int)Farm.Steals, (int)Farm.Correct, Same ? "same results":"RESULTS DIFFER !"); }
+  printf("%d hardware threads\n", std::thread::hardware_concurrency());
+  fclose(Inp); delete [] Ref; delete [] Res;
+  return Fail ? 1:0; }
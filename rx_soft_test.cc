@@ -0,0 +1,57 @@
+// g++ -std=gnu++14 -O2 -I. -DWITH_RX_SOFT -o rx_soft_test rx_soft_test.cc ldpc.cpp bitcount.cpp
+
+// Graded soft input of RFM_RxPktData::SoftInput() against the two-level LDPC_Decoder::Input(Data, Err):
+// frame error rate and iterations per packet over Manchester chips with white noise, bursts and interference pulses.
+// The RSSI of the simulated packets follows Eb/N0 like in rxsched_test.cc.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "rfm.h"
+#include "ldpc_channel.h"
+
+const int     Packets = 3000;
+const int     MaxIter = 32;
+const uint8_t Noise   = 220;                // [-0.5dBm] RX_AverRSSI
+
+static RFM_RxDecoder Decoder;
+
+static int Decode(const RFM_RxPktData &Pkt, const uint8_t *Code, bool Soft, int &Iter) // returns 1 when the packet is lost
+{ if(Soft) Pkt.SoftInput(Decoder, Noise);
+      else Decoder.Input(Pkt.Data, Pkt.Err);
+  uint8_t Check=1;
+  for(Iter=1; Iter<=MaxIter; Iter++)
+  { Check=RFM_RxPktData::Iterate(Decoder, 1); if(Check==0) break; }
+  if(Iter>MaxIter) Iter=MaxIter;
+  uint8_t Out[RFM_RxPktData::Bytes]; Decoder.Output(Out);
+  return Check!=0 || memcmp(Out, Code, RFM_RxPktData::Bytes); }
+
+int main(int argc, char *argv[])
+{ srand(argc>1 ? atoi(argv[1]):1);
+  int Fail=0;
+  printf("channel  Eb/N0   hard FER iter    soft FER iter\n");
+  for(int Model=LDPC_Channel::AWGN; Model<=LDPC_Channel::Erasure; Model++)
+  { for(float EbN0=4.0; EbN0<=10.01; EbN0+=1.0)
+    { LDPC_Channel Channel(Model);
+      Channel.setEbN0(EbN0, 160.0/208);
+      int HardErr=0, SoftErr=0, HardIter=0, SoftIter=0;
+      for(int Pkt=0; Pkt<Packets; Pkt++)
+      { uint8_t Code[26];
+        for(int Idx=0; Idx<20; Idx++) Code[Idx]=rand();
+        LDPC_Encode(Code);
+        RFM_RxPktData RxPkt;
+        Channel.Transmit(RxPkt.Data, RxPkt.Err, 0, Code, RFM_RxPktData::Bytes);
+        RxPkt.RSSI = Noise-(int)(2*EbN0);                               // [-0.5dBm]
+        int Iter;
+        HardErr+=Decode(RxPkt, Code, 0, Iter); HardIter+=Iter;
+        SoftErr+=Decode(RxPkt, Code, 1, Iter); SoftIter+=Iter; }
+      double HardFER=(double)HardErr/Packets, SoftFER=(double)SoftErr/Packets;
+      printf("%-8s %4.1f    %7.4f %5.2f    %7.4f %5.2f\n", Channel.Name(), EbN0,
+             HardFER, (double)HardIter/Packets, SoftFER, (double)SoftIter/Packets);
+      if(SoftFER>HardFER+0.005) Fail++;                                 // no real loss where errors are not bursty
+      if(Model==LDPC_Channel::Burst && EbN0>=6.0 && (SoftFER>0.8*HardFER || SoftIter>=HardIter) ) Fail++; // a clear gain on bursts
+    }
+  }
+  return Fail ? 1:0; }
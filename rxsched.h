@@ -0,0 +1,100 @@
+#ifndef __RXSCHED_H__
+#define __RXSCHED_H__
+
+#include <stdint.h>
+
+#include "fifo.h"
+#include "rfm.h"
+
+// Decode scheduler for the received packets: under heavy traffic RF_RxFIFO should not back up behind hopeless packets.
+// Every packet gets an iteration budget from the FIFO depth, the time left till the once-per-slot processing in vTaskPROC
+// and a cheap quality estimate: the number of Manchester errors and the RSSI margin over the noise.
+// The best packet waiting in the FIFO is decoded first, but waiting raises the priority, so weak packets are not starved:
+// they are decoded or dropped when too old. Packets which can not be corrected are dropped undecoded.
+// Clean packets: no Manchester errors or all parity checks pass, cost a few microseconds thus always go through.
+// The budget counts the iterations of the decoder schedule in use, as RFM_RxPktData::Iterate() takes them.
+
+class RX_DecodeSched
+{ public:
+   static const uint8_t  MaxIter  = RFM_RxPktData::MaxIter; // iterations when there is no pressure: as RFM_RxPktData::Decode() has it
+#if defined(WITH_LDPC_LAYERED) || defined(WITH_LDPC_COMPACT)
+   static const uint8_t  MinIter  =  1;     // fewer than this is not worth a try: the packet is dropped
+   static const uint16_t IterTime = 400;    // [us] a layered iteration: about two flooding ones, half as many are needed
+#else
+   static const uint8_t  MinIter  =  2;
+   static const uint16_t IterTime = 200;    // [us] estimated time of one decoder iteration on the STM32F103
+#endif
+   static const uint8_t  MaxErr   = 48;     // more Manchester errors than the parity bits: can not be corrected
+   static const uint16_t SlotEnd  = 300;    // [ms] vTaskPROC starts its once-per-slot work this late after the PPS
+   static const uint16_t MaxAge   =  50;    // [ms] packets waiting longer are dropped
+   static const uint8_t  AgeWeight=   4;    // [1/ms] priority gained by waiting
+
+   uint16_t Decoded;                        // [packets] given to the decoder
+   uint16_t Dropped;                        // [packets] removed from the FIFO without decoding
+   uint16_t Deferred;                       // [packets] passed over for a better packet
+
+  public:
+   RX_DecodeSched() { Clear(); }
+
+   void Clear(void) { Decoded=0; Dropped=0; Deferred=0; }
+
+   static uint16_t msLeft(uint16_t msTime)                          // [ms] time left till the slot processing
+   { msTime%=1000;
+     return msTime<SlotEnd ? SlotEnd-msTime : 1000+SlotEnd-msTime; }
+
+   static uint16_t Age(const RFM_RxPktData &Pkt, uint16_t msTime)  // [ms] how long the packet waits, msTime as in RFM_RxPktData
+   { msTime%=1000; if(msTime<200) msTime+=1000;                     // received packets have msTime from 200 to 1199
+     int16_t Wait = msTime-Pkt.msTime;
+     if(Wait<0) Wait+=1000;
+     return Wait; }
+
+   static uint8_t Quality(const RFM_RxPktData &Pkt, uint8_t Noise)  // 0 = hopeless, 255 = no Manchester errors and strong signal
+   { uint8_t Err=Pkt.ErrCount();
+     if(Err>MaxErr) return 0;
+     uint8_t Qual = 255-5*Err;                                      // 255..15
+     if(Pkt.RSSI+12>=Noise) Qual-=Qual>>2;                          // less than 6dB over the noise: less likely to decode
+     return Qual; }
+
+   static bool isClean(const RFM_RxPktData &Pkt)                   // no Manchester errors or all parity checks pass
+   { return Pkt.ErrCount()==0 || LDPC_Check(Pkt.Data)==0; }
+
+   uint8_t Budget(uint8_t Qual, uint8_t Depth, uint16_t msLeft, uint16_t Age=0, bool Clean=0) const // number of iterations for a packet, 0 = drop it
+   { if(Clean) { uint8_t Iter=Budget(Qual, Depth, msLeft); return Iter>MinIter ? Iter:MinIter; } // clean packets are never dropped
+     if(Qual==0 || Age>MaxAge) return 0;
+     uint32_t Iter = (uint32_t)msLeft*1000/IterTime;                // iterations which fit in the time left
+     if(Depth>1) Iter/=Depth;                                       // shared among the packets waiting
+     Iter = (Iter*Qual)>>7;                                         // good packets get up to twice the share
+     if(Iter>MaxIter) Iter=MaxIter;
+     if(Iter<MinIter) return 0;
+     return Iter; }
+
+   static uint16_t Priority(uint8_t Qual, uint16_t Age)
+   { return Qual + AgeWeight*(Age>MaxAge ? MaxAge:Age); }
+
+   template <size_t Size>
+    RFM_RxPktData *Select(FIFO<RFM_RxPktData, Size> &Fifo, uint8_t Noise, uint16_t msTime) // move the best packet to the FIFO head
+   { size_t Depth=Fifo.Full();
+     if(Depth==0) return 0;
+     size_t Best=0; uint16_t BestPrio=0;
+     for(size_t Idx=0; Idx<Depth; Idx++)
+     { const RFM_RxPktData *Pkt = Fifo.getRead(Idx);
+       uint16_t Prio=Priority(Quality(*Pkt, Noise), Age(*Pkt, msTime));
+       if(Idx==0 || Prio>BestPrio) { Best=Idx; BestPrio=Prio; }
+     }
+     RFM_RxPktData *Head = Fifo.getRead(0);
+     if(Best)                                                       // the RF task only writes past the last element, thus we can swap
+     { RFM_RxPktData Swap = *Head; *Head = *Fifo.getRead(Best); *Fifo.getRead(Best) = Swap;
+       Deferred++; }
+     return Head; }
+
+   template <size_t Size>
+    uint8_t getBudget(FIFO<RFM_RxPktData, Size> &Fifo, uint8_t Noise, uint16_t msTime) // budget for the packet at the FIFO head
+   { const RFM_RxPktData *Pkt = Fifo.getRead(0);
+     uint8_t Iter = Budget(Quality(*Pkt, Noise), Fifo.Full(), msLeft(msTime), Age(*Pkt, msTime), isClean(*Pkt));
+     if(Iter) Decoded++;
+         else Dropped++;
+     return Iter; }
+
+} ;
+
+#endif // __RXSCHED_H__
@@ -0,0 +1,114 @@
+// g++ -std=gnu++14 -O2 -I. -o rxsched_test rxsched_test.cc ldpc.cpp bitcount.cpp
+
+// Simulation of the vTaskPROC receive path under overload: packets arrive in the receive windows into the 16-element
+// RF_RxFIFO and a single decoder serves them, one iteration taking RX_DecodeSched::IterTime. The fixed 32-iteration
+// limit is compared with RX_DecodeSched: packet losses, correctly decoded packets and the decode latency.
+// Clean packets (no Manchester errors or all parity checks pass) must never be dropped by the scheduler.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+
+#include "rxsched.h"
+#include "ldpc_channel.h"
+
+const int    Seconds   = 20;
+const int    Rate      = 250;               // [packets/sec] arrival rate within the receive windows
+const double TickDelay = 1000;              // [us] vTaskDelay(1) in the vTaskPROC loop
+const uint8_t Noise    = 220;               // [-0.5dBm] RX_AverRSSI
+
+struct Arrival
+{ double   Time;                            // [us]
+  uint8_t  Code[26];                        // transmitted packet
+  bool     Good;                            // strong packet: should decode
+  RFM_RxPktData Pkt; } ;
+
+static Arrival *Arr;
+static int Arrivals=0;
+
+static void MakeArrivals(void)              // Poisson arrivals between 0.4 and 1.2 sec of every second: half strong, half weak packets
+{ Arr = new Arrival[Seconds*Rate*2];
+  LDPC_Channel Channel(LDPC_Channel::AWGN);
+  for(int Sec=0; Sec<Seconds; Sec++)
+  { double Time=400000;
+    for( ; ; )
+    { Time += -log(LDPC_Channel::Uniform())*1e6/Rate;
+      if(Time>=1200000) break;
+      Arrival &A = Arr[Arrivals];
+      A.Time = Sec*1e6+Time;
+      A.Good = rand()&1;
+      float EbN0 = A.Good ? 7.0+3.0*LDPC_Channel::Uniform() : 1.0+4.0*LDPC_Channel::Uniform();
+      Channel.setEbN0(EbN0, 160.0/208);
+      for(int Idx=0; Idx<20; Idx++) A.Code[Idx]=rand();
+      LDPC_Encode(A.Code);
+      Channel.Transmit(A.Pkt.Data, A.Pkt.Err, 0, A.Code, 26);
+      A.Pkt.Time=Arrivals; A.Pkt.msTime=(int)(Time/1000); A.Pkt.Channel=0;
+      A.Pkt.RSSI = Noise - (int)(2*EbN0);                           // stronger packets: lower RSSI value [-0.5dBm]
+      Arrivals++; }
+  }
+}
+
+static RFM_RxDecoder Decoder;
+
+static int Decode(const RFM_RxPktData &Pkt, uint8_t Iter, bool &OK) // returns the number of iterations used
+{ Decoder.Input(Pkt.Data, Pkt.Err);
+  int Used=0; int8_t Check=1;
+  while(Check && Used<Iter) { Check=Decoder.ProcessChecks(); Used++; }
+  uint8_t Out[26]; Decoder.Output(Out);
+  OK = Check==0 && memcmp(Out, Arr[Pkt.Time].Code, 26)==0;
+  return Used; }
+
+static int Simulate(bool Sched, double &MaxLatency, int &CleanDropped)
+{ static FIFO<RFM_RxPktData, 16> Fifo; Fifo.Clear();
+  RX_DecodeSched Scheduler;
+  double *Latency = new double[Arrivals]; int Decoded=0;
+  int Lost=0; int GoodOK=0; int WeakOK=0; int Good=0; CleanDropped=0;
+  int Next=0; double Now=0;
+  while(Next<Arrivals || !Fifo.isEmpty())
+  { if(Fifo.isEmpty() && Arr[Next].Time>Now) Now=Arr[Next].Time;
+    for( ; Next<Arrivals && Arr[Next].Time<=Now; Next++)
+    { if(Arr[Next].Good) Good++;
+      if(Fifo.isFull()) { Lost++; continue; }
+      *Fifo.getWrite()=Arr[Next].Pkt; Fifo.Write(); }
+    if(Fifo.isEmpty()) continue;
+    RFM_RxPktData *Pkt; uint8_t Iter;
+    if(Sched)
+    { uint16_t msTime = (uint32_t)(Now/1000)%1000;
+      Pkt=Scheduler.Select(Fifo, Noise, msTime);
+      Iter=Scheduler.getBudget(Fifo, Noise, msTime); }
+    else
+    { Pkt=Fifo.getRead(); Iter=RX_DecodeSched::MaxIter; }
+    bool OK=0; int Used = Iter ? Decode(*Pkt, Iter, OK):0;
+    double Finish = Now + TickDelay + Used*RX_DecodeSched::IterTime;
+    const Arrival &A = Arr[Pkt->Time];
+    if(OK) { if(A.Good) GoodOK++; else WeakOK++; }
+    if(Iter) Latency[Decoded++] = Finish-A.Time;
+        else if(RX_DecodeSched::isClean(*Pkt)) CleanDropped++;
+    for( ; Next<Arrivals && Arr[Next].Time<Finish; Next++)          // arrivals while decoding: the FIFO still holds this packet
+    { if(Arr[Next].Good) Good++;
+      if(Fifo.isFull()) { Lost++; continue; }
+      *Fifo.getWrite()=Arr[Next].Pkt; Fifo.Write(); }
+    Fifo.Read(); Now=Finish; }
+  std::sort(Latency, Latency+Decoded);
+  MaxLatency = Latency[Decoded-1]/1000;
+  printf("%-9s %6d %6d %7d %7d %8d %8d %8d %9.1f %9.1f\n", Sched?"scheduled":"fixed",
+         Arrivals, Lost, Scheduler.Dropped, Scheduler.Deferred, GoodOK, Good, WeakOK,
+         Latency[Decoded*99/100]/1000, MaxLatency);
+  delete [] Latency;
+  return GoodOK; }
+
+int main(int argc, char *argv[])
+{ srand(argc>1 ? atoi(argv[1]):1);
+  MakeArrivals();
+  printf("policy    arrived  lost dropped deferred  good-OK  of-good  weak-OK  p99[ms]  max[ms]\n");
+  double FixedMax, SchedMax; int CleanDropped;
+  int FixedOK = Simulate(0, FixedMax, CleanDropped);
+  int SchedOK = Simulate(1, SchedMax, CleanDropped);
+  delete [] Arr;
+  RX_DecodeSched Sched;                                             // clean packets go through late in the slot and when old
+  bool CleanOK = Sched.Budget(255, 3, 1, 0, 1)>=RX_DecodeSched::MinIter && Sched.Budget(255, 1, 300, 51, 1)>=RX_DecodeSched::MinIter
+              && Sched.Budget(0, 16, 1, 200, 1)>=RX_DecodeSched::MinIter && CleanDropped==0;
+  printf("clean packets dropped by the scheduler: %d\n", CleanDropped);
+  return (SchedMax<FixedMax && SchedOK>=FixedOK && CleanOK) ? 0:1; }
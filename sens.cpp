@@ -86,7 +86,6 @@ static LowPass2<int64_t,10,9,12> PressAver, // low pass (average) filter for pre
 
 static Delay<int32_t, 8>        PressDelay; // 4-second delay for long-term climb rate
 
-static char Line[64];                       // line to prepare the barometer NMEA sentence
 
 static uint8_t InitBaro()
 { // xSemaphoreTake(I2C_Mutex, portMAX_DELAY);
@@ -208,48 +207,51 @@ static void ProcBaro(void)
         PosPtr->hasBaro=1; }                                         // tick "hasBaro" flag
     }
 
-    uint8_t Len=0;                                                   // start preparing the barometer NMEA sentence
-    Len+=Format_String(Line+Len, "$POGNB,");
-    Len+=Format_UnsDec(Line+Len, Sec, 3, 1);                         // [sec] measurement time
-    Line[Len++]=',';
-    Len+=Format_SignDec(Line+Len, Baro.Temperature, 2, 1);           // [degC] temperature
-    Line[Len++]=',';
-    Len+=Format_UnsDec(Line+Len, (uint32_t)(10*Pressure+2)>>2, 2, 1); // [Pa] pressure
-    Line[Len++]=',';
-    Len+=Format_UnsDec(Line+Len, Noise, 2, 1);                       // [Pa] pressure noise
-    Line[Len++]=',';
-    Len+=Format_SignDec(Line+Len, StdAltitude, 2, 1);                // [m] standard altitude (calc. from pressure)
-    Line[Len++]=',';
-    Len+=Format_SignDec(Line+Len, Altitude,    2, 1);                // [m] altitude (from cross-calc. with the GPS)
-    Line[Len++]=',';
-    Len+=Format_SignDec(Line+Len, ClimbRate,   3, 2);                // [m/s] climb rate
-    Line[Len++]=',';
+    NMEA_Builder NMEA;
+    NMEA.Start("POGNB");                                             // start preparing the barometer NMEA sentence
+    NMEA.Comma();
+    NMEA.UnsDec(Sec, 3, 1);                                          // [sec] measurement time
+    NMEA.Comma();
+    NMEA.SignDec(Baro.Temperature, 2, 1);                            // [degC] temperature
+    NMEA.Comma();
+    NMEA.UnsDec((uint32_t)(10*Pressure+2)>>2, 2, 1);                 // [Pa] pressure
+    NMEA.Comma();
+    NMEA.UnsDec(Noise, 2, 1);                                        // [Pa] pressure noise
+    NMEA.Comma();
+    NMEA.SignDec(StdAltitude, 2, 1);                                 // [m] standard altitude (calc. from pressure)
+    NMEA.Comma();
+    NMEA.SignDec(Altitude,    2, 1);                                 // [m] altitude (from cross-calc. with the GPS)
+    NMEA.Comma();
+    NMEA.SignDec(ClimbRate,   3, 2);                                 // [m/s] climb rate
+    NMEA.Comma();
 #ifdef WITH_BME280
-    Len+=Format_SignDec(Line+Len, Baro.Humidity,3, 1);                // [%] relative humidity
-    Line[Len++]=',';
+    NMEA.SignDec(Baro.Humidity,3, 1);                                // [%] relative humidity
+    NMEA.Comma();
 #endif
-    Len+=NMEA_AppendCheckCRNL(Line, Len);
+    NMEA.Finish();
+    Format_BlockSink Cons(CONS_UART_WriteBlock);                     // the sentences go to the FIFOs as blocks
     // if(CONS_UART_Free()>=128)
     { xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
-      Format_String(CONS_UART_Write, Line, 0, Len);                       // send NMEA sentence to the console (UART1)
+      NMEA.Send(Cons);                                               // send NMEA sentence to the console (UART1)
       xSemaphoreGive(CONS_Mutex); }
 #ifdef WITH_SDLOG
     if(Log_Free()>=128)
-    { xSemaphoreTake(Log_Mutex, portMAX_DELAY);
-      Format_String(Log_Write, Line, Len, 0);                             // send NMEA sentence to the log file
+    { Format_BlockSink LogFile(Log_WriteBlock);
+      xSemaphoreTake(Log_Mutex, portMAX_DELAY);
+      NMEA.Send(LogFile);                                          // send NMEA sentence to the log file
       xSemaphoreGive(Log_Mutex); }
 #endif
 
-    Len=0;                                                           // start preparing the PGRMZ NMEA sentence
-    Len+=Format_String(Line+Len, "$PGRMZ,");
-    Len+=Format_SignDec(Line+Len, StdAltitude, 2, 1);                // [m] standard altitude (calc. from pressure)
-    Line[Len++]=',';
-    Len+=Format_String(Line+Len, "m,");                              // normally f for feet, but metres and m works with XcSoar
-    Len+=Format_String(Line+Len, "3");                               // 1 no fix, 2 - 2D, 3 - 3D; assume 3D for now
-    Len+=NMEA_AppendCheckCRNL(Line, Len);
+    NMEA.Start("PGRMZ");                                             // start preparing the PGRMZ NMEA sentence
+    NMEA.Comma();
+    NMEA.SignDec(StdAltitude, 2, 1);                                 // [m] standard altitude (calc. from pressure)
+    NMEA.Comma();
+    NMEA.String("m,");                                               // normally f for feet, but metres and m works with XcSoar
+    NMEA.String("3");                                                // 1 no fix, 2 - 2D, 3 - 3D; assume 3D for now
+    NMEA.Finish();
     // if(CONS_UART_Free()>=128)
     { xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
-      Format_String(CONS_UART_Write, Line, 0, Len);                           // send NMEA sentence to the console (UART1)
+      NMEA.Send(Cons);                                               // send NMEA sentence to the console (UART1)
       xSemaphoreGive(CONS_Mutex); }
 
 }
@@ -9,10 +9,21 @@
 #include "misc.h"
 
 #include "fifo.h"
+#if defined(WITH_UART1_TX_DMA) || defined(WITH_UART1_RX_DMA)
+#include "uart_dma.h"
+#endif
+#ifdef WITH_UART1_TX_DMA
+static void UART1_TxDMA_Config(void);
+#endif
+#ifdef WITH_UART1_RX_DMA
+static void UART1_RxDMA_Config(void);
+#endif
 
 #include "uart1.h"
 
+#ifndef WITH_UART1_RX_DMA
 FIFO<uint8_t, UART1_RxFIFO_Size> UART1_RxFIFO;
+#endif
 FIFO<uint8_t, UART1_TxFIFO_Size> UART1_TxFIFO;
 
 // UART1 pins:
@@ -31,18 +42,128 @@ void UART1_Configuration (int BaudRate)
   UART_ConfigGPIO(GPIOA, GPIO_Pin_10, GPIO_Pin_9);      // Configure USART1 Rx (PA10) as input, and USART1 Tx (PA9) as output
   UART_ConfigUSART(USART1, BaudRate);
 
+#ifdef WITH_UART1_RX_DMA
+  UART1_TxFIFO.Clear();
+#else
   UART1_RxFIFO.Clear(); UART1_TxFIFO.Clear();
+#endif
+#ifdef WITH_UART1_TX_DMA
+  UART1_TxDMA_Config();                                // transmit through DMA
+#endif
   USART_Cmd(USART1, ENABLE);                            // Enable USART1
+#ifdef WITH_UART1_RX_DMA
+  UART1_RxDMA_Config();                                // receive through DMA, interrupt on the idle line
+#else
   USART_ITConfig(USART1, USART_IT_RXNE, ENABLE);        // Enable Rx-not-empty interrupt
+#endif
   // NVIC_EnableIRQ(USART1_IRQn);
 }
 
+#ifdef WITH_UART1_TX_DMA
+// the TxFIFO is drained by DMA1 channel 4: a few interrupts per block instead of one per byte
+
+static UART_TxDMA< FIFO<uint8_t, UART1_TxFIFO_Size> > UART1_TxDMA;
+static TaskHandle_t UART1_TxWaiting = 0;                    // writer which waits for space in the TxFIFO
+
+static void UART1_TxDMA_Start(void)                          // next transfer: from the DMA interrupt or with it masked
+{ uint8_t *Block;
+  uint16_t Len=UART1_TxDMA.Start(UART1_TxFIFO, Block);
+  DMA1_Channel4->CCR &= ~DMA_CCR1_EN;
+  if(Len==0) return;                                         // FIFO empty: the channel stays idle
+  DMA1_Channel4->CMAR  = (uint32_t)Block;
+  DMA1_Channel4->CNDTR = Len;
+  DMA1_Channel4->CCR  |= DMA_CCR1_EN; }
+
+static void UART1_TxDMA_Config(void)
+{ RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+  DMA1_Channel4->CCR   = 0;
+  DMA1_Channel4->CPAR  = (uint32_t)&USART1->DR;
+  DMA1_Channel4->CCR   = DMA_CCR1_MINC | DMA_CCR1_DIR | DMA_CCR1_TCIE | DMA_CCR1_HTIE; // memory => UART, 8-bit, low priority
+  DMA1->IFCR = DMA_IFCR_CGIF4;
+  UART1_TxDMA.Clear();
+  NVIC_SetPriority(DMA1_Channel4_IRQn, 12);                 // below configMAX_SYSCALL_INTERRUPT_PRIORITY: it calls the RTOS
+  NVIC_EnableIRQ(DMA1_Channel4_IRQn);
+  USART_DMACmd(USART1, USART_DMAReq_Tx, ENABLE); }
+
+#ifdef __cplusplus
+  extern "C"
+#endif
+void DMA1_Channel4_IRQHandler(void)                          // half and complete transfer: free the sent bytes, wake the writer
+{ uint32_t Flags = DMA1->ISR;
+  DMA1->IFCR = DMA_IFCR_CGIF4;
+  UART1_TxDMA.Progress(UART1_TxFIFO, DMA1_Channel4->CNDTR);
+  if(Flags&DMA_ISR_TCIF4) UART1_TxDMA_Start();                   // transfer complete: on to the next region
+  if(UART1_TxWaiting)
+  { BaseType_t Woken=pdFALSE;
+    vTaskNotifyGiveFromISR(UART1_TxWaiting, &Woken); UART1_TxWaiting=0;
+    portYIELD_FROM_ISR(Woken); }
+}
+
+void UART1_TxKick(void)                                      // start the DMA unless it runs already
+{ NVIC_DisableIRQ(DMA1_Channel4_IRQn);
+  if(UART1_TxDMA.isIdle()) UART1_TxDMA_Start();
+  NVIC_EnableIRQ(DMA1_Channel4_IRQn); }
+
+static void UART1_TxWait(void)                               // TxFIFO full: sleep until the DMA interrupt frees some
+{ UART1_TxWaiting=xTaskGetCurrentTaskHandle();
+  if(UART1_TxFIFO.Free()==0) ulTaskNotifyTake(pdTRUE, 2);    // the timeout only as a safety net
+  UART1_TxWaiting=0; }
+#else
+static void UART1_TxWait(void) { vTaskDelay(1); }           // TxFIFO full: wait for the TXE interrupt to drain it
+#endif
+
+#ifdef WITH_UART1_RX_DMA
+// the received data goes by DMA1 channel 5 into a circular buffer: the reader is woken when the line goes idle
+
+static UART_RxDMA<UART1_RxDMA_Size> UART1_RxDMA;
+static TaskHandle_t     UART1_RxWaiting    = 0;                // reader which sleeps in UART1_RxWait()
+static volatile uint8_t UART1_RxEvents     = 0;                // counts the idle-line and the half/full buffer events
+static          uint8_t UART1_RxEventsSeen = 0;                // the events the reader has seen already
+
+static void UART1_RxDMA_Config(void)
+{ RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+  UART1_RxDMA.Clear();
+  DMA1_Channel5->CCR   = 0;
+  DMA1_Channel5->CPAR  = (uint32_t)&USART1->DR;
+  DMA1_Channel5->CMAR  = (uint32_t)UART1_RxDMA.Data;
+  DMA1_Channel5->CNDTR = UART1_RxDMA_Size;
+  DMA1->IFCR = DMA_IFCR_CGIF5;
+  DMA1_Channel5->CCR   = DMA_CCR1_MINC | DMA_CCR1_CIRC | DMA_CCR1_TCIE | DMA_CCR1_HTIE | DMA_CCR1_EN; // UART => memory, circular, 8-bit
+  NVIC_SetPriority(DMA1_Channel5_IRQn, 12);                 // both interrupts call the RTOS
+  NVIC_EnableIRQ(DMA1_Channel5_IRQn);
+  NVIC_SetPriority(USART1_IRQn, 12);
+  USART_DMACmd(USART1, USART_DMAReq_Rx, ENABLE);
+  USART_ITConfig(USART1, USART_IT_IDLE, ENABLE); }
+
+static void UART1_RxWake(void)                               // from the interrupts: wake the reader
+{ UART1_RxEvents++;
+  if(UART1_RxWaiting==0) return;
+  BaseType_t Woken=pdFALSE;
+  vTaskNotifyGiveFromISR(UART1_RxWaiting, &Woken);
+  portYIELD_FROM_ISR(Woken); }
+
+#ifdef __cplusplus
+  extern "C"
+#endif
+void DMA1_Channel5_IRQHandler(void)                          // buffer half or all full: a long burst, let the reader catch up
+{ if(DMA1->ISR & DMA_ISR_TCIF5) UART1_RxDMA.Laps++;          // the DMA went around the buffer
+  DMA1->IFCR = DMA_IFCR_CGIF5;
+  UART1_RxWake(); }
+#endif
+
 #ifdef __cplusplus
   extern "C"
 #endif
 void USART1_IRQHandler(void)
-{ if(USART_GetITStatus(USART1, USART_IT_RXNE) != RESET)
+{
+#ifdef WITH_UART1_RX_DMA
+  if(USART_GetITStatus(USART1, USART_IT_IDLE) != RESET)
+  { UART1_RxChar();                                         // reading SR then DR clears the idle flag
+    UART1_RxWake(); }
+#else
+  if(USART_GetITStatus(USART1, USART_IT_RXNE) != RESET)
    while(UART1_RxReady()) { uint8_t Byte=UART1_RxChar(); UART1_RxFIFO.Write(Byte); } // write received bytes to the RxFIFO
+#endif
   if(USART_GetITStatus(USART1, USART_IT_TXE) != RESET)
    while(UART1_TxEmpty())
   { uint8_t Byte;
@@ -53,14 +174,49 @@ void USART1_IRQHandler(void)
   // USART_ClearITPendingBit(USART1, USART_IT_TXE);
 }
 
+#ifdef WITH_UART1_RX_DMA
+static uint16_t UART1_RxRemain(void)                        // the DMA count register, once the data the DMA ran over is dropped
+{ uint32_t Laps; uint16_t Remain;
+  do { Laps=UART1_RxDMA.Laps; Remain=DMA1_Channel5->CNDTR; } while(Laps!=UART1_RxDMA.Laps); // a matching pair: the interrupt can come in between
+  UART1_RxDMA.Overrun(Remain, Laps);
+  return Remain; }
+
+int UART1_Read(uint8_t &Byte) { return UART1_RxDMA.Read(Byte, UART1_RxRemain()); }
+
+int UART1_ReadBlock(uint8_t *&Block) { return UART1_RxDMA.getReadBlock(Block, UART1_RxRemain()); }
+
+void UART1_FlushRead(int Len) { UART1_RxDMA.flushReadBlock(Len); }
+
+int UART1_RxWait(uint32_t Ticks)                             // sleep until the line goes idle or the buffer fills up
+{ UART1_RxWaiting=xTaskGetCurrentTaskHandle();
+  if(UART1_RxEvents==UART1_RxEventsSeen) ulTaskNotifyTake(pdTRUE, Ticks); // the count: a TxWait() of the same task may take the notification
+  UART1_RxWaiting=0;                                        // no more wake-ups from the idle-line and DMA interrupts
+  UART1_RxEventsSeen=UART1_RxEvents;
+  return UART1_RxDMA.Full(UART1_RxRemain()); }              // bytes waiting to be read
+#else
 int UART1_Read(uint8_t &Byte) { return UART1_RxFIFO.Read(Byte); } // return number of bytes read (0 or 1)
+#endif
 
 void UART1_Write(char Byte)
-{ if(UART1_TxFIFO.isEmpty()) { UART1_TxFIFO.Write(Byte); UART1_TxKick(); return; }
+{
+#ifdef WITH_UART1_TX_DMA
+  while(UART1_TxFIFO.Write(Byte)<=0) { UART1_TxKick(); UART1_TxWait(); }
+  UART1_TxKick();                                             // cheap when the DMA runs already
+#else
+  if(UART1_TxFIFO.isEmpty()) { UART1_TxFIFO.Write(Byte); UART1_TxKick(); return; }
   if(UART1_TxFIFO.Write(Byte)>0) return;
   UART1_TxKick();
-  while(UART1_TxFIFO.Write(Byte)<=0) vTaskDelay(1); // taskYIELD();
+  while(UART1_TxFIFO.Write(Byte)<=0) UART1_TxWait();
+#endif
   return; }
 
+void UART1_WriteBlock(const char *Data, int Len)             // a block into the TxFIFO: the FIFO and the interrupt are touched once per block
+{ for( ; ; )
+  { int Done=UART1_TxFIFO.Write((const uint8_t *)Data, Len);
+    if(Done) UART1_TxKick();
+    Data+=Done; Len-=Done; if(Len<=0) break;
+    UART1_TxWait(); }                                       // wait for the FIFO to drain
+}
+
 int UART1_Free(void) { return UART1_TxFIFO.Free(); }
 int UART1_Full(void) { return UART1_TxFIFO.Full(); }
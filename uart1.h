@@ -19,8 +19,18 @@ void inline UART1_TxChar(char ch) { USART_SendData(USART1, ch); }
 char inline UART1_RxChar(void)    { return (uint8_t)USART_ReceiveData(USART1); }
 
 int  UART1_Read(uint8_t &Byte);
+#ifdef WITH_UART1_RX_DMA
+int  UART1_ReadBlock(uint8_t *&Block);                     // received bytes which are contiguous in the DMA buffer
+void UART1_FlushRead(int Len);                             // to be used after UART1_ReadBlock()
+int  UART1_RxWait(uint32_t Ticks);                         // sleep until the line goes idle: returns the number of bytes waiting
+#endif
 void UART1_Write(char Byte);
+void UART1_WriteBlock(const char *Data, int Len);
+#ifdef WITH_UART1_TX_DMA
+void UART1_TxKick(void);                                   // start the TxDMA if idle
+#else
 void inline UART1_TxKick(void) { USART_ITConfig(USART1, USART_IT_TXE, ENABLE); }
+#endif
 int  UART1_Free(void);
 int  UART1_Full(void);
 
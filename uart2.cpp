@@ -11,8 +11,19 @@
 #include "uart2.h"
 
 #include "fifo.h"
+#if defined(WITH_UART2_TX_DMA) || defined(WITH_UART2_RX_DMA)
+#include "uart_dma.h"
+#endif
+#ifdef WITH_UART2_TX_DMA
+static void UART2_TxDMA_Config(void);
+#endif
+#ifdef WITH_UART2_RX_DMA
+static void UART2_RxDMA_Config(void);
+#endif
 
+#ifndef WITH_UART2_RX_DMA
 FIFO<uint8_t, UART2_RxFIFO_Size> UART2_RxFIFO;
+#endif
 FIFO<uint8_t, UART2_TxFIFO_Size> UART2_TxFIFO;
 
 // UART2 pins:
@@ -32,18 +43,128 @@ void UART2_Configuration (int BaudRate)
   UART_ConfigGPIO(GPIOA, GPIO_Pin_3, GPIO_Pin_2);
   UART_ConfigUSART(USART2, BaudRate);
 
+#ifdef WITH_UART2_RX_DMA
+  UART2_TxFIFO.Clear();
+#else
   UART2_RxFIFO.Clear(); UART2_TxFIFO.Clear();
+#endif
+#ifdef WITH_UART2_TX_DMA
+  UART2_TxDMA_Config();                                // transmit through DMA
+#endif
   USART_Cmd(USART2, ENABLE);                            // Enable USART2
+#ifdef WITH_UART2_RX_DMA
+  UART2_RxDMA_Config();                                // receive through DMA, interrupt on the idle line
+#else
   USART_ITConfig(USART2, USART_IT_RXNE, ENABLE);
+#endif
   // NVIC_EnableIRQ(USART2_IRQn);
 }
 
+#ifdef WITH_UART2_TX_DMA
+// the TxFIFO is drained by DMA1 channel 7: a few interrupts per block instead of one per byte
+
+static UART_TxDMA< FIFO<uint8_t, UART2_TxFIFO_Size> > UART2_TxDMA;
+static TaskHandle_t UART2_TxWaiting = 0;                    // writer which waits for space in the TxFIFO
+
+static void UART2_TxDMA_Start(void)                          // next transfer: from the DMA interrupt or with it masked
+{ uint8_t *Block;
+  uint16_t Len=UART2_TxDMA.Start(UART2_TxFIFO, Block);
+  DMA1_Channel7->CCR &= ~DMA_CCR1_EN;
+  if(Len==0) return;                                         // FIFO empty: the channel stays idle
+  DMA1_Channel7->CMAR  = (uint32_t)Block;
+  DMA1_Channel7->CNDTR = Len;
+  DMA1_Channel7->CCR  |= DMA_CCR1_EN; }
+
+static void UART2_TxDMA_Config(void)
+{ RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+  DMA1_Channel7->CCR   = 0;
+  DMA1_Channel7->CPAR  = (uint32_t)&USART2->DR;
+  DMA1_Channel7->CCR   = DMA_CCR1_MINC | DMA_CCR1_DIR | DMA_CCR1_TCIE | DMA_CCR1_HTIE; // memory => UART, 8-bit, low priority
+  DMA1->IFCR = DMA_IFCR_CGIF7;
+  UART2_TxDMA.Clear();
+  NVIC_SetPriority(DMA1_Channel7_IRQn, 12);                 // below configMAX_SYSCALL_INTERRUPT_PRIORITY: it calls the RTOS
+  NVIC_EnableIRQ(DMA1_Channel7_IRQn);
+  USART_DMACmd(USART2, USART_DMAReq_Tx, ENABLE); }
+
+#ifdef __cplusplus
+  extern "C"
+#endif
+void DMA1_Channel7_IRQHandler(void)                          // half and complete transfer: free the sent bytes, wake the writer
+{ uint32_t Flags = DMA1->ISR;
+  DMA1->IFCR = DMA_IFCR_CGIF7;
+  UART2_TxDMA.Progress(UART2_TxFIFO, DMA1_Channel7->CNDTR);
+  if(Flags&DMA_ISR_TCIF7) UART2_TxDMA_Start();                   // transfer complete: on to the next region
+  if(UART2_TxWaiting)
+  { BaseType_t Woken=pdFALSE;
+    vTaskNotifyGiveFromISR(UART2_TxWaiting, &Woken); UART2_TxWaiting=0;
+    portYIELD_FROM_ISR(Woken); }
+}
+
+void UART2_TxKick(void)                                      // start the DMA unless it runs already
+{ NVIC_DisableIRQ(DMA1_Channel7_IRQn);
+  if(UART2_TxDMA.isIdle()) UART2_TxDMA_Start();
+  NVIC_EnableIRQ(DMA1_Channel7_IRQn); }
+
+static void UART2_TxWait(void)                               // TxFIFO full: sleep until the DMA interrupt frees some
+{ UART2_TxWaiting=xTaskGetCurrentTaskHandle();
+  if(UART2_TxFIFO.Free()==0) ulTaskNotifyTake(pdTRUE, 2);    // the timeout only as a safety net
+  UART2_TxWaiting=0; }
+#else
+static void UART2_TxWait(void) { vTaskDelay(1); }           // TxFIFO full: wait for the TXE interrupt to drain it
+#endif
+
+#ifdef WITH_UART2_RX_DMA
+// the received data goes by DMA1 channel 6 into a circular buffer: the reader is woken when the line goes idle
+
+static UART_RxDMA<UART2_RxDMA_Size> UART2_RxDMA;
+static TaskHandle_t     UART2_RxWaiting    = 0;                // reader which sleeps in UART2_RxWait()
+static volatile uint8_t UART2_RxEvents     = 0;                // counts the idle-line and the half/full buffer events
+static          uint8_t UART2_RxEventsSeen = 0;                // the events the reader has seen already
+
+static void UART2_RxDMA_Config(void)
+{ RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+  UART2_RxDMA.Clear();
+  DMA1_Channel6->CCR   = 0;
+  DMA1_Channel6->CPAR  = (uint32_t)&USART2->DR;
+  DMA1_Channel6->CMAR  = (uint32_t)UART2_RxDMA.Data;
+  DMA1_Channel6->CNDTR = UART2_RxDMA_Size;
+  DMA1->IFCR = DMA_IFCR_CGIF6;
+  DMA1_Channel6->CCR   = DMA_CCR1_MINC | DMA_CCR1_CIRC | DMA_CCR1_TCIE | DMA_CCR1_HTIE | DMA_CCR1_EN; // UART => memory, circular, 8-bit
+  NVIC_SetPriority(DMA1_Channel6_IRQn, 12);                 // both interrupts call the RTOS
+  NVIC_EnableIRQ(DMA1_Channel6_IRQn);
+  NVIC_SetPriority(USART2_IRQn, 12);
+  USART_DMACmd(USART2, USART_DMAReq_Rx, ENABLE);
+  USART_ITConfig(USART2, USART_IT_IDLE, ENABLE); }
+
+static void UART2_RxWake(void)                               // from the interrupts: wake the reader
+{ UART2_RxEvents++;
+  if(UART2_RxWaiting==0) return;
+  BaseType_t Woken=pdFALSE;
+  vTaskNotifyGiveFromISR(UART2_RxWaiting, &Woken);
+  portYIELD_FROM_ISR(Woken); }
+
+#ifdef __cplusplus
+  extern "C"
+#endif
+void DMA1_Channel6_IRQHandler(void)                          // buffer half or all full: a long burst, let the reader catch up
+{ if(DMA1->ISR & DMA_ISR_TCIF6) UART2_RxDMA.Laps++;          // the DMA went around the buffer
+  DMA1->IFCR = DMA_IFCR_CGIF6;
+  UART2_RxWake(); }
+#endif
+
 #ifdef __cplusplus
   extern "C"
 #endif
 void USART2_IRQHandler(void)
-{ if(USART_GetITStatus(USART2, USART_IT_RXNE) != RESET)
+{
+#ifdef WITH_UART2_RX_DMA
+  if(USART_GetITStatus(USART2, USART_IT_IDLE) != RESET)
+  { UART2_RxChar();                                         // reading SR then DR clears the idle flag
+    UART2_RxWake(); }
+#else
+  if(USART_GetITStatus(USART2, USART_IT_RXNE) != RESET)
    while(UART2_RxReady()) { uint8_t Byte=UART2_RxChar(); UART2_RxFIFO.Write(Byte); } // write received bytes to the RxFIFO
+#endif
   if(USART_GetITStatus(USART2, USART_IT_TXE) != RESET)
    while(UART2_TxEmpty())
   { uint8_t Byte;
@@ -52,15 +173,50 @@ void USART2_IRQHandler(void)
   // USART_ClearITPendingBit(USART2, USART_IT_TC);
 }
 
+#ifdef WITH_UART2_RX_DMA
+static uint16_t UART2_RxRemain(void)                        // the DMA count register, once the data the DMA ran over is dropped
+{ uint32_t Laps; uint16_t Remain;
+  do { Laps=UART2_RxDMA.Laps; Remain=DMA1_Channel6->CNDTR; } while(Laps!=UART2_RxDMA.Laps); // a matching pair: the interrupt can come in between
+  UART2_RxDMA.Overrun(Remain, Laps);
+  return Remain; }
+
+int UART2_Read(uint8_t &Byte) { return UART2_RxDMA.Read(Byte, UART2_RxRemain()); }
+
+int UART2_ReadBlock(uint8_t *&Block) { return UART2_RxDMA.getReadBlock(Block, UART2_RxRemain()); }
+
+void UART2_FlushRead(int Len) { UART2_RxDMA.flushReadBlock(Len); }
+
+int UART2_RxWait(uint32_t Ticks)                             // sleep until the line goes idle or the buffer fills up
+{ UART2_RxWaiting=xTaskGetCurrentTaskHandle();
+  if(UART2_RxEvents==UART2_RxEventsSeen) ulTaskNotifyTake(pdTRUE, Ticks); // the count: a TxWait() of the same task may take the notification
+  UART2_RxWaiting=0;                                        // no more wake-ups from the idle-line and DMA interrupts
+  UART2_RxEventsSeen=UART2_RxEvents;
+  return UART2_RxDMA.Full(UART2_RxRemain()); }              // bytes waiting to be read
+#else
 int UART2_Read(uint8_t &Byte) { return UART2_RxFIFO.Read(Byte); }
+#endif
 
 void UART2_Write(char Byte)
-{ if(UART2_TxFIFO.isEmpty()) { UART2_TxFIFO.Write(Byte); UART2_TxKick(); return; }
+{
+#ifdef WITH_UART2_TX_DMA
+  while(UART2_TxFIFO.Write(Byte)<=0) { UART2_TxKick(); UART2_TxWait(); }
+  UART2_TxKick();                                             // cheap when the DMA runs already
+#else
+  if(UART2_TxFIFO.isEmpty()) { UART2_TxFIFO.Write(Byte); UART2_TxKick(); return; }
   if(UART2_TxFIFO.Write(Byte)>0) return;
   UART2_TxKick();
-  while(UART2_TxFIFO.Write(Byte)<=0) vTaskDelay(1); // taskYIELD();
+  while(UART2_TxFIFO.Write(Byte)<=0) UART2_TxWait();
+#endif
   return; }
 
+void UART2_WriteBlock(const char *Data, int Len)             // a block into the TxFIFO: the FIFO and the interrupt are touched once per block
+{ for( ; ; )
+  { int Done=UART2_TxFIFO.Write((const uint8_t *)Data, Len);
+    if(Done) UART2_TxKick();
+    Data+=Done; Len-=Done; if(Len<=0) break;
+    UART2_TxWait(); }                                       // wait for the FIFO to drain
+}
+
 // Note: UARTx_Write() can only be used after the RTOS is started as they use vTaskDelay()/taskYIELD()
 
 int UART2_Free(void) { return UART2_TxFIFO.Free(); }
@@ -17,10 +17,20 @@ int  inline UART2_RxReady(void)   { return USART_GetFlagStatus(USART2, USART_FLA
 void inline UART2_TxChar(char ch) { USART_SendData(USART2, ch); }
 char inline UART2_RxChar(void)    { return (uint8_t)USART_ReceiveData(USART2); }
 
+#ifdef WITH_UART2_TX_DMA
+void UART2_TxKick(void);                                   // start the TxDMA if idle
+#else
 inline void UART2_TxKick(void) { USART_ITConfig(USART2, USART_IT_TXE, ENABLE); }
+#endif
 
 int  UART2_Read(uint8_t &Byte);
+#ifdef WITH_UART2_RX_DMA
+int  UART2_ReadBlock(uint8_t *&Block);                     // received bytes which are contiguous in the DMA buffer
+void UART2_FlushRead(int Len);                             // to be used after UART2_ReadBlock()
+int  UART2_RxWait(uint32_t Ticks);                         // sleep until the line goes idle: returns the number of bytes waiting
+#endif
 void UART2_Write(char Byte);
+void UART2_WriteBlock(const char *Data, int Len);
 int  UART2_Free(void);
 int  UART2_Full(void);
 
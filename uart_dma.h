@@ -0,0 +1,77 @@
+#ifndef __UART_DMA_H__
+#define __UART_DMA_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Bookkeeping for a DMA channel which drains a UART TxFIFO: a transfer takes the contiguous region at the read pointer,
+// the half-transfer and transfer-complete interrupts give back to the FIFO what has been sent so far.
+// The writers keep filling the FIFO meanwhile: they never touch the region being transferred.
+// The channel registers stay in uart1.cpp/uart2.cpp, thus this part runs on the host as well.
+
+template <class FIFO_Type, class Type=uint8_t>
+ class UART_TxDMA
+{ public:
+   volatile uint16_t Len;                  // [bytes] length of the transfer in progress, 0 = channel idle
+   volatile uint16_t Done;                 // [bytes] of it already flushed from the FIFO
+
+  public:
+   void Clear(void) { Len=0; Done=0; }
+
+   bool isIdle(void) const { return Len==0; }
+
+   uint16_t Start(FIFO_Type &FIFO, Type *&Block)        // the next region to transfer: zero when the FIFO is empty
+   { Len=FIFO.getReadBlock(Block); Done=0; return Len; }
+
+   void Progress(FIFO_Type &FIFO, uint16_t Remain)      // Remain = the DMA count register: free the bytes sent since the last call
+   { uint16_t Sent=Len-Remain;
+     FIFO.flushReadBlock(Sent-Done); Done=Sent; }
+
+} ;
+
+// A DMA channel which receives a UART into a circular buffer: the channel runs forever, the write pointer
+// is read from its count register, the reader takes the bytes in contiguous blocks as from a FIFO.
+// The idle-line interrupt tells the reader when a burst has ended, no interrupt per byte.
+// The transfer-complete interrupt counts the laps: when the DMA has gone over the unread data, the reader drops all of it.
+
+template <uint16_t Size, class Type=uint8_t>
+ class UART_RxDMA
+{ public:
+   Type     Data[Size];                    // the circular buffer, written by the DMA
+   uint16_t ReadPtr;                       // where the reader is
+   volatile uint32_t Laps;                 // counted by the transfer-complete interrupt: times the DMA went around the buffer
+   uint32_t ReadCount;                     // [bytes] read or dropped since Clear()
+   uint32_t Lost;                          // [bytes] dropped on the overruns
+
+  public:
+   void Clear(void) { ReadPtr=0; Laps=0; ReadCount=0; Lost=0; }
+
+   size_t Overrun(uint16_t Remain, uint32_t LapCount)   // Remain and Laps read as a pair: when the DMA went over the unread data
+   { uint32_t Unread = LapCount*Size+WritePtr(Remain)-ReadCount; // drop all of it, return the number of bytes lost
+     if(Unread<Size) return 0;                          // a full buffer counts as well: Full() could not tell it from an empty one
+     if(Unread>=0x80000000) return 0;                   // the wrap is there but its interrupt is still pending: not an overrun
+     ReadPtr=WritePtr(Remain); ReadCount+=Unread; Lost+=Unread;
+     return Unread; }
+
+   static uint16_t WritePtr(uint16_t Remain)            // Remain = the DMA count register: Size just after a wrap
+   { return Remain>=Size ? 0 : Size-Remain; }
+
+   size_t Full(uint16_t Remain) const                   // number of bytes received and not read yet
+   { int Len = (int)WritePtr(Remain)-ReadPtr; if(Len<0) Len+=Size; return Len; }
+
+   size_t getReadBlock(Type *&Block, uint16_t Remain)   // the received bytes which are contiguous in the buffer
+   { uint16_t Ptr=WritePtr(Remain);
+     Block = Data+ReadPtr;
+     if(ReadPtr<=Ptr) return Ptr-ReadPtr;
+     return Size-ReadPtr; }
+
+   void flushReadBlock(size_t Len)                      // to be used after getReadBlock()
+   { ReadPtr+=Len; if(ReadPtr>=Size) ReadPtr-=Size; ReadCount+=Len; }
+
+   int Read(Type &Byte, uint16_t Remain)                // a single byte, as FIFO::Read()
+   { Type *Block; if(getReadBlock(Block, Remain)==0) return 0;
+     Byte=*Block; flushReadBlock(1); return 1; }
+
+} ;
+
+#endif // __UART_DMA_H__
@@ -0,0 +1,129 @@
+// g++ -std=gnu++14 -O2 -I. -o uart_dma_test uart_dma_test.cc
+// the DMA channel is simulated byte by byte: the test runs on the host only
+
+// The console TxFIFO drained by the DMA bookkeeping of uart_dma.h against the TXE interrupt per byte:
+// a simulated UART clocks out one byte per step, the DMA count register goes down with it,
+// the half-transfer and transfer-complete interrupts call Progress() and Start() as DMA1_ChannelN_IRQHandler() does.
+// The writers put NMEA-sized sentences in bursts into the FIFO as UARTn_WriteBlock() does, waiting when it is full.
+// Checks that the byte stream comes out intact and counts the interrupts per sentence.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "fifo.h"
+#include "uart_dma.h"
+
+static uint32_t Random=12345;
+static uint32_t Rand(void) { Random = Random*1103515245+12345; return Random>>8; }
+
+// ----------------------------------------------------------------------------------------------------------------
+
+typedef FIFO<uint8_t, 512> TxFIFO_Type;
+
+static TxFIFO_Type TxFIFO;
+static UART_TxDMA<TxFIFO_Type> TxDMA;
+
+static uint8_t *DMA_Addr;                                          // the channel registers: CMAR, CNDTR and EN
+static uint16_t DMA_Count;
+static bool     DMA_Enable;
+
+static uint32_t IRQs;                                              // interrupts taken
+static uint32_t Wakes;                                             // writer notifications
+
+static uint8_t  Output[1<<20];                                     // what came out of the UART
+static uint32_t OutputLen;
+
+static bool TxWaiting;                                             // a writer sleeps on the notification
+
+static void DMA_Start(void)                                        // as UARTn_TxDMA_Start()
+{ uint8_t *Block;
+  uint16_t Len=TxDMA.Start(TxFIFO, Block);
+  DMA_Enable=0;
+  if(Len==0) return;
+  DMA_Addr=Block; DMA_Count=Len; DMA_Enable=1; }
+
+static void DMA_IRQ(bool Complete)                                 // as DMA1_ChannelN_IRQHandler()
+{ IRQs++;
+  TxDMA.Progress(TxFIFO, DMA_Count);
+  if(Complete) DMA_Start();
+  if(TxWaiting) { Wakes++; TxWaiting=0; } }
+
+static void TxKick(void) { if(TxDMA.isIdle()) DMA_Start(); }       // as UARTn_TxKick()
+
+static void DMA_Step(void)                                         // one byte time of the UART
+{ if(!DMA_Enable) return;
+  uint16_t Len=TxDMA.Len;
+  Output[OutputLen++] = DMA_Addr[Len-DMA_Count];
+  DMA_Count--;
+  if(DMA_Count==0) { DMA_Enable=0; DMA_IRQ(1); return; }
+  if( (Len>=2) && (Len-DMA_Count)==(Len/2) ) DMA_IRQ(0); }          // half-transfer
+
+// ----------------------------------------------------------------------------------------------------------------
+// the same with the TXE interrupt per byte: as USART1_IRQHandler() before
+
+static TxFIFO_Type TxeFIFO;
+static bool        TxeEnable;
+static uint32_t    TxeIRQs;
+static uint8_t     TxeOutput[1<<20];
+static uint32_t    TxeOutputLen;
+
+static void TXE_Step(void)
+{ if(!TxeEnable) return;
+  TxeIRQs++;
+  uint8_t Byte;
+  if(TxeFIFO.Read(Byte)<=0) { TxeEnable=0; return; }                // nothing left: disable the interrupt
+  TxeOutput[TxeOutputLen++]=Byte; }
+
+// ----------------------------------------------------------------------------------------------------------------
+
+static uint8_t  Input[1<<20];                                      // what the writers wrote
+static uint32_t InputLen;
+
+static int MakeSentence(char *Line)                                // an NMEA-like line of 40..82 characters
+{ int Len=40+Rand()%43;
+  Line[0]='$';
+  for(int Idx=1; Idx<Len-2; Idx++) Line[Idx]=' '+Rand()%95;
+  Line[Len-2]='\r'; Line[Len-1]='\n';
+  return Len; }
+
+int main(int argc, char *argv[])
+{ TxFIFO.Clear(); TxDMA.Clear(); TxeFIFO.Clear();
+
+  const int Bursts=400;
+  int Sentences=0, WriterWaits=0;
+  for(int Burst=0; Burst<Bursts; Burst++)
+  { int Lines=1+Rand()%12;                                        // a burst: from a single $POGNT up to a full GPS second
+    for(int Line=0; Line<Lines; Line++)
+    { char Sentence[96]; int Len=MakeSentence(Sentence);
+      memcpy(Input+InputLen, Sentence, Len); InputLen+=Len; Sentences++;
+      const char *Data=Sentence; int Left=Len;                     // DMA: as UARTn_WriteBlock()
+      for( ; ; )
+      { int Done=TxFIFO.Write((const uint8_t *)Data, Left);
+        if(Done) TxKick();
+        Data+=Done; Left-=Done; if(Left<=0) break;
+        TxWaiting=1; WriterWaits++;                                // sleep on the notification
+        while(TxWaiting) DMA_Step(); }
+      Data=Sentence; Left=Len;                                     // TXE: the same data
+      for( ; ; )
+      { int Done=TxeFIFO.Write((const uint8_t *)Data, Left);
+        if(Done) TxeEnable=1;
+        Data+=Done; Left-=Done; if(Left<=0) break;
+        TXE_Step(); }
+    }
+    int Idle=Rand()%600;                                           // the UART runs while the tasks do something else
+    for(int Step=0; Step<Idle; Step++) { DMA_Step(); TXE_Step(); }
+  }
+  while(DMA_Enable || !TxFIFO.isEmpty()) { DMA_Step(); if(!DMA_Enable) TxKick(); }
+  while(TxeEnable) TXE_Step();
+
+  bool OK = (OutputLen==InputLen) && memcmp(Output, Input, InputLen)==0
+         && (TxeOutputLen==InputLen) && memcmp(TxeOutput, Input, InputLen)==0
+         && TxDMA.isIdle() && TxFIFO.isEmpty();
+
+  printf("%d sentences, %d bytes, %d writer waits (%d notifications)\n", Sentences, InputLen, WriterWaits, Wakes);
+  printf("TXE interrupt per byte: %8d IRQs = %5.2f per sentence\n", TxeIRQs, (double)TxeIRQs/Sentences);
+  printf("DMA half/complete:      %8d IRQs = %5.2f per sentence\n", IRQs, (double)IRQs/Sentences);
+  printf("%s\n", OK?"OK":"FAILED: the DMA stream differs");
+  return OK?0:1; }